@@ -319,24 +319,26 @@ void G1BarrierSetAssembler::g1_write_barrier_post(MacroAssembler* masm,
 
   __ movb(Address(card_addr, 0), G1CardTable::dirty_card_val());
 
-  // The code below assumes that buffer index is pointer sized.
-  STATIC_ASSERT(in_bytes(G1DirtyCardQueue::byte_width_of_index()) == sizeof(intptr_t));
-
-  __ movptr(tmp2, queue_index);
-  __ testptr(tmp2, tmp2);
-  __ jcc(Assembler::zero, runtime);
-  __ subptr(tmp2, wordSize);
-  __ movptr(queue_index, tmp2);
-  __ addptr(tmp2, buffer);
-  __ movptr(Address(tmp2, 0), card_addr);
-  __ jmp(done);
-
-  __ bind(runtime);
-  // save the live input values
-  RegSet saved = RegSet::of(store_addr NOT_LP64(COMMA thread));
-  __ push_set(saved);
-  __ call_VM_leaf(CAST_FROM_FN_PTR(address, G1BarrierSetRuntime::write_ref_field_post_entry), card_addr, thread);
-  __ pop_set(saved);
+  if (!G1UseCardTableRefinement) {
+    // The code below assumes that buffer index is pointer sized.
+    STATIC_ASSERT(in_bytes(G1DirtyCardQueue::byte_width_of_index()) == sizeof(intptr_t));
+
+    __ movptr(tmp2, queue_index);
+    __ testptr(tmp2, tmp2);
+    __ jcc(Assembler::zero, runtime);
+    __ subptr(tmp2, wordSize);
+    __ movptr(queue_index, tmp2);
+    __ addptr(tmp2, buffer);
+    __ movptr(Address(tmp2, 0), card_addr);
+    __ jmp(done);
+
+    __ bind(runtime);
+    // save the live input values
+    RegSet saved = RegSet::of(store_addr NOT_LP64(COMMA thread));
+    __ push_set(saved);
+    __ call_VM_leaf(CAST_FROM_FN_PTR(address, G1BarrierSetRuntime::write_ref_field_post_entry), card_addr, thread);
+    __ pop_set(saved);
+  }
 
   __ bind(done);
 }
@@ -555,27 +557,29 @@ void G1BarrierSetAssembler::generate_c1_post_barrier_runtime_stub(StubAssembler*
 
   __ movb(Address(card_addr, 0), CardTable::dirty_card_val());
 
-  const Register tmp = rdx;
-  __ push(rdx);
+  if (!G1UseCardTableRefinement) {
+    const Register tmp = rdx;
+    __ push(rdx);
 
-  __ movptr(tmp, queue_index);
-  __ testptr(tmp, tmp);
-  __ jcc(Assembler::zero, runtime);
-  __ subptr(tmp, wordSize);
-  __ movptr(queue_index, tmp);
-  __ addptr(tmp, buffer);
-  __ movptr(Address(tmp, 0), card_addr);
-  __ jmp(enqueued);
+    __ movptr(tmp, queue_index);
+    __ testptr(tmp, tmp);
+    __ jcc(Assembler::zero, runtime);
+    __ subptr(tmp, wordSize);
+    __ movptr(queue_index, tmp);
+    __ addptr(tmp, buffer);
+    __ movptr(Address(tmp, 0), card_addr);
+    __ jmp(enqueued);
 
-  __ bind(runtime);
-  __ push_call_clobbered_registers();
+    __ bind(runtime);
+    __ push_call_clobbered_registers();
 
-  __ call_VM_leaf(CAST_FROM_FN_PTR(address, G1BarrierSetRuntime::write_ref_field_post_entry), card_addr, thread);
+    __ call_VM_leaf(CAST_FROM_FN_PTR(address, G1BarrierSetRuntime::write_ref_field_post_entry), card_addr, thread);
 
-  __ pop_call_clobbered_registers();
+    __ pop_call_clobbered_registers();
 
-  __ bind(enqueued);
-  __ pop(rdx);
+    __ bind(enqueued);
+    __ pop(rdx);
+  }
 
   __ bind(done);
   __ pop(rcx);
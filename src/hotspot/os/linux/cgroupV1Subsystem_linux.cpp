@@ -268,6 +268,12 @@ jlong CgroupV1Subsystem::cache_usage_in_bytes() {
   return cache;
 }
 
+double CgroupV1Subsystem::memory_pressure() {
+  // Pressure stall information is only available with cgroups v2.
+  log_trace(os, container)("Memory Pressure is not supported.");
+  return OSCONTAINER_ERROR;
+}
+
 jlong CgroupV1Subsystem::kernel_memory_usage_in_bytes() {
   julong kmem_usage;
   CONTAINER_READ_NUMBER_CHECKED(_memory->controller(), "/memory.kmem.usage_in_bytes", "Kernel Memory Usage", kmem_usage);
@@ -167,6 +167,33 @@ jlong CgroupV2Subsystem::cache_usage_in_bytes() {
   return (jlong)cache;
 }
 
+/* memory_pressure
+ *
+ * Return the share of wall time in percent in which at least some tasks
+ * of this cgroup were stalled waiting for memory, averaged over the last
+ * ten seconds. This is the "some avg10" value of the pressure stall
+ * information (PSI) in memory.pressure.
+ *
+ * return:
+ *    memory pressure in percent or
+ *    OSCONTAINER_ERROR for not supported
+ */
+double CgroupV2Subsystem::memory_pressure() {
+  char buf[1024];
+  bool is_ok = _memory->controller()->read_string("/memory.pressure", buf, sizeof(buf));
+  if (!is_ok) {
+    log_trace(os, container)("Memory Pressure failed: %d", OSCONTAINER_ERROR);
+    return OSCONTAINER_ERROR;
+  }
+  double avg10;
+  if (sscanf(buf, "some avg10=%lf", &avg10) != 1) {
+    log_trace(os, container)("Memory Pressure could not be parsed: %s", buf);
+    return OSCONTAINER_ERROR;
+  }
+  log_trace(os, container)("Memory Pressure is: %.2f", avg10);
+  return avg10;
+}
+
 // Note that for cgroups v2 the actual limits set for swap and
 // memory live in two different files, memory.swap.max and memory.max
 // respectively. In order to properly report a cgroup v1 like
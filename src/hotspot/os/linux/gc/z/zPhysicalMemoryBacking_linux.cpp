@@ -35,6 +35,7 @@
 #include "hugepages.hpp"
 #include "logging/log.hpp"
 #include "os_linux.hpp"
+#include "runtime/globals_extension.hpp"
 #include "runtime/init.hpp"
 #include "runtime/os.hpp"
 #include "runtime/safefetch.hpp"
@@ -194,6 +195,10 @@ ZPhysicalMemoryBacking::ZPhysicalMemoryBacking(size_t max_capacity)
     return;
   }
 
+  if (ZReserveLargePages && !reserve_large_pages(max_capacity)) {
+    return;
+  }
+
   // Successfully initialized
   _initialized = true;
 }
@@ -595,6 +600,28 @@ ZErrno ZPhysicalMemoryBacking::fallocate(bool punch_hole, zoffset offset, size_t
   return err;
 }
 
+bool ZPhysicalMemoryBacking::reserve_large_pages(size_t max_capacity) {
+  if (!is_hugetlbfs()) {
+    log_warning_p(gc, init)("-XX:+ZReserveLargePages ignored, requires -XX:+UseLargePages on a %s filesystem",
+                            ZFILESYSTEM_HUGETLBFS);
+    FLAG_SET_ERGO(ZReserveLargePages, false);
+    return true;
+  }
+
+  // Mapping the whole backing file reserves huge pages for all of it in the
+  // huge page pool, without associating them with file segments. The pages
+  // stay reserved for this file until holes are punched in it, so committing
+  // memory later can't fail because other processes drained the pool.
+  const ZErrno err = fallocate_compat_mmap_hugetlbfs(zoffset(0), max_capacity, false /* touch */);
+  if (err) {
+    log_error_p(gc)("Failed to reserve " SIZE_FORMAT "M of large pages (%s)", max_capacity / M, err.to_string());
+    return false;
+  }
+
+  log_info_p(gc, init)("Reserved Large Pages: " SIZE_FORMAT "M", max_capacity / M);
+  return true;
+}
+
 bool ZPhysicalMemoryBacking::commit_inner(zoffset offset, size_t length) const {
   log_trace(gc, heap)("Committing memory: " SIZE_FORMAT "M-" SIZE_FORMAT "M (" SIZE_FORMAT "M)",
                       untype(offset) / M, untype(to_zoffset_end(offset, length)) / M, length / M);
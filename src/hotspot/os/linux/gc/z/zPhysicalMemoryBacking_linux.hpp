@@ -58,6 +58,8 @@ class ZPhysicalMemoryBacking {
   ZErrno split_and_fallocate(bool punch_hole, zoffset offset, size_t length) const;
   ZErrno fallocate(bool punch_hole, zoffset offset, size_t length) const;
 
+  bool reserve_large_pages(size_t max_capacity);
+
   bool commit_inner(zoffset offset, size_t length) const;
   size_t commit_numa_interleaved(zoffset offset, size_t length) const;
   size_t commit_default(zoffset offset, size_t length) const;
@@ -107,6 +107,11 @@ jlong OSContainer::cache_usage_in_bytes() {
   return cgroup_subsystem->cache_usage_in_bytes();
 }
 
+double OSContainer::memory_pressure() {
+  assert(cgroup_subsystem != nullptr, "cgroup subsystem not available");
+  return cgroup_subsystem->memory_pressure();
+}
+
 void OSContainer::print_version_specific_info(outputStream* st) {
   assert(cgroup_subsystem != nullptr, "cgroup subsystem not available");
   cgroup_subsystem->print_version_specific_info(st);
@@ -58,6 +58,7 @@ class OSContainer: AllStatic {
   static jlong memory_max_usage_in_bytes();
   static jlong rss_usage_in_bytes();
   static jlong cache_usage_in_bytes();
+  static double memory_pressure();
 
   static int active_processor_count();
 
@@ -1918,6 +1918,7 @@ char* FileMapInfo::map_bitmap_region() {
 // We relocate all pointers in the 2 core regions (ro, rw).
 bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
   log_debug(cds, reloc)("runtime archive relocation start");
+  jlong start_ns = os::javaTimeNanos();
   char* bitmap_base = map_bitmap_region();
 
   if (bitmap_base == nullptr) {
@@ -1958,6 +1959,9 @@ bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
     // The MetaspaceShared::bm region will be unmapped in MetaspaceShared::initialize_shared_spaces().
 
     log_debug(cds, reloc)("runtime archive relocation done");
+    log_info(cds)("Relocated %s archive by " INTX_FORMAT " bytes in " JLONG_FORMAT " us",
+                  is_static() ? "static" : "dynamic", addr_delta,
+                  (os::javaTimeNanos() - start_ns) / (NANOUNITS / MICROUNITS));
     return true;
   }
 }
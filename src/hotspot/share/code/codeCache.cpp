@@ -1730,10 +1730,11 @@ void CodeCache::print_summary(outputStream* st, bool detailed) {
                  size, used, max_used, free);
 
     if (detailed) {
-      st->print_cr(" bounds [" INTPTR_FORMAT ", " INTPTR_FORMAT ", " INTPTR_FORMAT "]",
+      st->print_cr(" bounds [" INTPTR_FORMAT ", " INTPTR_FORMAT ", " INTPTR_FORMAT "] page_size=" SIZE_FORMAT "Kb",
                    p2i(heap->low_boundary()),
                    p2i(heap->high()),
-                   p2i(heap->high_boundary()));
+                   p2i(heap->high_boundary()),
+                   heap->page_size()/K);
 
       full_count += get_codemem_full_count(heap->code_blob_type());
     }
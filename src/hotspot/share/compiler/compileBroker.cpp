@@ -190,6 +190,9 @@ uint CompileBroker::_sum_nmethod_size               = 0;
 uint CompileBroker::_sum_nmethod_code_size          = 0;
 
 jlong CompileBroker::_peak_compilation_time        = 0;
+jlong CompileBroker::_sum_queue_wait_ticks         = 0;
+jlong CompileBroker::_peak_queue_wait_ticks        = 0;
+uint  CompileBroker::_queue_wait_count             = 0;
 
 CompilerStatistics CompileBroker::_stats_per_level[CompLevel_full_optimization];
 
@@ -1028,6 +1031,14 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
   size_t available_cc_np  = CodeCache::unallocated_capacity(CodeBlobType::MethodNonProfiled),
          available_cc_p   = CodeCache::unallocated_capacity(CodeBlobType::MethodProfiled);
 
+  // Optionally cap the total number of compiler threads by a share of the
+  // CPUs available to the VM. active_processor_count() honors the container
+  // CPU quota, so compiler threads cannot crowd out the application there.
+  int cpu_cap = INT_MAX;
+  if (DynamicCompilerThreadsCPUPercent > 0) {
+    cpu_cap = MAX2(1, (int)(os::active_processor_count() * DynamicCompilerThreadsCPUPercent / 100));
+  }
+
   // Only do attempt to start additional threads if the lock is free.
   if (!CompileThread_lock->try_lock()) return;
 
@@ -1037,6 +1048,10 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
         _c2_compile_queue->size() / 2,
         (int)(free_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
+    if (cpu_cap != INT_MAX) {
+      int c1_threads = _c1_compile_queue != nullptr ? _compilers[0]->num_compiler_threads() : 0;
+      new_c2_count = MIN2(new_c2_count, cpu_cap - c1_threads);
+    }
 
     for (int i = old_c2_count; i < new_c2_count; i++) {
 #if INCLUDE_JVMCI
@@ -1098,6 +1113,10 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
         _c1_compile_queue->size() / 4,
         (int)(free_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
+    if (cpu_cap != INT_MAX) {
+      int c2_threads = _c2_compile_queue != nullptr ? _compilers[1]->num_compiler_threads() : 0;
+      new_c1_count = MIN2(new_c1_count, cpu_cap - c2_threads);
+    }
 
     for (int i = old_c1_count; i < new_c1_count; i++) {
       JavaThread *ct = make_thread(compiler_t, compiler1_object(i), _c1_compile_queue, _compilers[0], THREAD);
@@ -2516,6 +2535,14 @@ void CompileBroker::collect_statistics(CompilerThread* thread, elapsedTimer time
   // C1 and C2 counters are counting both successful and unsuccessful compiles
   _t_total_compilation.add(time);
 
+  if (CITime && task->time_started() != 0) {
+    // Time the task spent waiting in the compile queue, for all outcomes.
+    jlong wait = task->time_started() - task->time_queued();
+    _sum_queue_wait_ticks += wait;
+    _peak_queue_wait_ticks = MAX2(_peak_queue_wait_ticks, wait);
+    _queue_wait_count++;
+  }
+
   if (!success) {
     _total_bailout_count++;
     if (UsePerfData) {
@@ -2712,6 +2739,10 @@ void CompileBroker::print_times(bool per_compiler, bool aggregate) {
   tty->print_cr("    Invalidated            : %7.3f s, Average : %2.3f s",
                 CompileBroker::_t_invalidated_compilation.seconds(),
                 total_invalidated_count == 0 ? 0.0 : CompileBroker::_t_invalidated_compilation.seconds() / total_invalidated_count);
+  tty->print_cr("  Compile queue wait time  : %7.3f s, Average : %2.3f s, Max : %2.3f s",
+                TimeHelper::counter_to_seconds(_sum_queue_wait_ticks),
+                _queue_wait_count == 0 ? 0.0 : TimeHelper::counter_to_seconds(_sum_queue_wait_ticks) / _queue_wait_count,
+                TimeHelper::counter_to_seconds(_peak_queue_wait_ticks));
 
   AbstractCompiler *comp = compiler(CompLevel_simple);
   if (comp != nullptr) {
@@ -231,6 +231,9 @@ class CompileBroker: AllStatic {
   static uint _sum_nmethod_size;
   static uint _sum_nmethod_code_size;
   static jlong _peak_compilation_time;
+  static jlong _sum_queue_wait_ticks;
+  static jlong _peak_queue_wait_ticks;
+  static uint  _queue_wait_count;
 
   static CompilerStatistics _stats_per_level[];
 
@@ -352,6 +352,11 @@ void G1BarrierSetC2::g1_mark_card(GraphKit* kit,
   // Smash zero into card. MUST BE ORDERED WRT TO STORE
   __ storeCM(__ ctrl(), card_adr, zero, oop_store, oop_alias_idx, card_bt, Compile::AliasIdxRaw);
 
+  if (G1UseCardTableRefinement) {
+    // Concurrent refinement finds the card by sweeping the card table.
+    return;
+  }
+
   //  Now do the queue work
   __ if_then(index, BoolTest::ne, zeroX); {
 
@@ -44,58 +44,83 @@ G1Allocator::G1Allocator(G1CollectedHeap* heap) :
   _survivor_is_full(false),
   _old_is_full(false),
   _num_alloc_regions(_numa->num_active_nodes()),
+  _num_mutator_stripes(G1MutatorAllocRegionStripes),
   _mutator_alloc_regions(nullptr),
   _survivor_gc_alloc_regions(nullptr),
-  _old_gc_alloc_region(heap->alloc_buffer_stats(G1HeapRegionAttr::Old)),
-  _retained_old_gc_alloc_region(nullptr) {
+  _num_old_alloc_regions(G1NUMAAwarePromotion ? (uint)_num_alloc_regions : 1),
+  _old_gc_alloc_regions(nullptr),
+  _retained_old_gc_alloc_regions(nullptr) {
 
-  _mutator_alloc_regions = NEW_C_HEAP_ARRAY(MutatorAllocRegion, _num_alloc_regions, mtGC);
+  _mutator_alloc_regions = NEW_C_HEAP_ARRAY(MutatorAllocRegion, num_mutator_alloc_regions(), mtGC);
   _survivor_gc_alloc_regions = NEW_C_HEAP_ARRAY(SurvivorGCAllocRegion, _num_alloc_regions, mtGC);
   G1EvacStats* stat = heap->alloc_buffer_stats(G1HeapRegionAttr::Young);
 
+  for (uint i = 0; i < num_mutator_alloc_regions(); i++) {
+    ::new(_mutator_alloc_regions + i) MutatorAllocRegion(i / _num_mutator_stripes);
+  }
   for (uint i = 0; i < _num_alloc_regions; i++) {
-    ::new(_mutator_alloc_regions + i) MutatorAllocRegion(i);
     ::new(_survivor_gc_alloc_regions + i) SurvivorGCAllocRegion(stat, i);
   }
+
+  _old_gc_alloc_regions = NEW_C_HEAP_ARRAY(OldGCAllocRegion, _num_old_alloc_regions, mtGC);
+  _retained_old_gc_alloc_regions = NEW_C_HEAP_ARRAY(G1HeapRegion*, _num_old_alloc_regions, mtGC);
+  G1EvacStats* old_stat = heap->alloc_buffer_stats(G1HeapRegionAttr::Old);
+
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    // Without NUMA aware promotion, the single old GC alloc region takes regions from any node.
+    uint node_index = _num_old_alloc_regions > 1 ? i : G1NUMA::AnyNodeIndex;
+    ::new(_old_gc_alloc_regions + i) OldGCAllocRegion(old_stat, node_index);
+    _retained_old_gc_alloc_regions[i] = nullptr;
+  }
 }
 
 G1Allocator::~G1Allocator() {
-  for (uint i = 0; i < _num_alloc_regions; i++) {
+  for (uint i = 0; i < num_mutator_alloc_regions(); i++) {
     _mutator_alloc_regions[i].~MutatorAllocRegion();
+  }
+  for (uint i = 0; i < _num_alloc_regions; i++) {
     _survivor_gc_alloc_regions[i].~SurvivorGCAllocRegion();
   }
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    _old_gc_alloc_regions[i].~OldGCAllocRegion();
+  }
   FREE_C_HEAP_ARRAY(MutatorAllocRegion, _mutator_alloc_regions);
   FREE_C_HEAP_ARRAY(SurvivorGCAllocRegion, _survivor_gc_alloc_regions);
+  FREE_C_HEAP_ARRAY(OldGCAllocRegion, _old_gc_alloc_regions);
+  FREE_C_HEAP_ARRAY(G1HeapRegion*, _retained_old_gc_alloc_regions);
 }
 
 #ifdef ASSERT
 bool G1Allocator::has_mutator_alloc_region() {
-  uint node_index = current_node_index();
-  return mutator_alloc_region(node_index)->get() != nullptr;
+  return current_mutator_alloc_region(current_node_index())->get() != nullptr;
 }
 #endif
 
 void G1Allocator::init_mutator_alloc_regions() {
-  for (uint i = 0; i < _num_alloc_regions; i++) {
+  for (uint i = 0; i < num_mutator_alloc_regions(); i++) {
     assert(mutator_alloc_region(i)->get() == nullptr, "pre-condition");
     mutator_alloc_region(i)->init();
   }
 }
 
 void G1Allocator::release_mutator_alloc_regions() {
-  for (uint i = 0; i < _num_alloc_regions; i++) {
+  for (uint i = 0; i < num_mutator_alloc_regions(); i++) {
     mutator_alloc_region(i)->release();
     assert(mutator_alloc_region(i)->get() == nullptr, "post-condition");
   }
 }
 
 bool G1Allocator::is_retained_old_region(G1HeapRegion* hr) {
-  return _retained_old_gc_alloc_region == hr;
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    if (_retained_old_gc_alloc_regions[i] == hr) {
+      return true;
+    }
+  }
+  return false;
 }
 
-void G1Allocator::reuse_retained_old_region(G1EvacInfo* evacuation_info,
-                                            OldGCAllocRegion* old,
-                                            G1HeapRegion** retained_old) {
+size_t G1Allocator::reuse_retained_old_region(OldGCAllocRegion* old,
+                                              G1HeapRegion** retained_old) {
   G1HeapRegion* retained_region = *retained_old;
   *retained_old = nullptr;
 
@@ -120,8 +145,9 @@ void G1Allocator::reuse_retained_old_region(G1EvacInfo* evacuation_info,
     _g1h->old_set_remove(retained_region);
     old->set(retained_region);
     G1HeapRegionPrinter::reuse(retained_region);
-    evacuation_info->set_alloc_regions_used_before(retained_region->used());
+    return retained_region->used();
   }
+  return 0;
 }
 
 void G1Allocator::init_gc_alloc_regions(G1EvacInfo* evacuation_info) {
@@ -134,10 +160,13 @@ void G1Allocator::init_gc_alloc_regions(G1EvacInfo* evacuation_info) {
     survivor_gc_alloc_region(i)->init();
   }
 
-  _old_gc_alloc_region.init();
-  reuse_retained_old_region(evacuation_info,
-                            &_old_gc_alloc_region,
-                            &_retained_old_gc_alloc_region);
+  size_t used_before = 0;
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    _old_gc_alloc_regions[i].init();
+    used_before += reuse_retained_old_region(&_old_gc_alloc_regions[i],
+                                             &_retained_old_gc_alloc_regions[i]);
+  }
+  evacuation_info->set_alloc_regions_used_before(used_before);
 }
 
 void G1Allocator::release_gc_alloc_regions(G1EvacInfo* evacuation_info) {
@@ -146,23 +175,26 @@ void G1Allocator::release_gc_alloc_regions(G1EvacInfo* evacuation_info) {
     survivor_region_count += survivor_gc_alloc_region(node_index)->count();
     survivor_gc_alloc_region(node_index)->release();
   }
-  evacuation_info->set_allocation_regions(survivor_region_count +
-                                          old_gc_alloc_region()->count());
-
-  // If we have an old GC alloc region to release, we'll save it in
-  // _retained_old_gc_alloc_region. If we don't
-  // _retained_old_gc_alloc_region will become null. This is what we
-  // want either way so no reason to check explicitly for either
-  // condition.
-  _retained_old_gc_alloc_region = old_gc_alloc_region()->release();
+  uint old_region_count = 0;
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    old_region_count += _old_gc_alloc_regions[i].count();
+    // If we have an old GC alloc region to release, we'll save it in
+    // _retained_old_gc_alloc_regions. If we don't the entry will become
+    // null. This is what we want either way so no reason to check
+    // explicitly for either condition.
+    _retained_old_gc_alloc_regions[i] = _old_gc_alloc_regions[i].release();
+  }
+  evacuation_info->set_allocation_regions(survivor_region_count + old_region_count);
 }
 
 void G1Allocator::abandon_gc_alloc_regions() {
   for (uint i = 0; i < _num_alloc_regions; i++) {
     assert(survivor_gc_alloc_region(i)->get() == nullptr, "pre-condition");
   }
-  assert(old_gc_alloc_region()->get() == nullptr, "pre-condition");
-  _retained_old_gc_alloc_region = nullptr;
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    assert(_old_gc_alloc_regions[i].get() == nullptr, "pre-condition");
+    _retained_old_gc_alloc_regions[i] = nullptr;
+  }
 }
 
 bool G1Allocator::survivor_is_full() const {
@@ -189,8 +221,7 @@ size_t G1Allocator::unsafe_max_tlab_alloc() {
   // since we can't allow tlabs to grow big enough to accommodate
   // humongous objects.
 
-  uint node_index = current_node_index();
-  G1HeapRegion* hr = mutator_alloc_region(node_index)->get();
+  G1HeapRegion* hr = current_mutator_alloc_region(current_node_index())->get();
   size_t max_tlab = _g1h->max_tlab_size() * wordSize;
 
   if (hr == nullptr || hr->free() < MinTLABSize) {
@@ -205,7 +236,7 @@ size_t G1Allocator::unsafe_max_tlab_alloc() {
 size_t G1Allocator::used_in_alloc_regions() {
   assert(Heap_lock->owner() != nullptr, "Should be owned on this thread's behalf.");
   size_t used = 0;
-  for (uint i = 0; i < _num_alloc_regions; i++) {
+  for (uint i = 0; i < num_mutator_alloc_regions(); i++) {
     used += mutator_alloc_region(i)->used_in_alloc_regions();
   }
   return used;
@@ -232,7 +263,7 @@ HeapWord* G1Allocator::par_allocate_during_gc(G1HeapRegionAttr dest,
     case G1HeapRegionAttr::Young:
       return survivor_attempt_allocation(min_word_size, desired_word_size, actual_word_size, node_index);
     case G1HeapRegionAttr::Old:
-      return old_attempt_allocation(min_word_size, desired_word_size, actual_word_size);
+      return old_attempt_allocation(min_word_size, desired_word_size, actual_word_size, node_index);
     default:
       ShouldNotReachHere();
       return nullptr; // Keep some compilers happy
@@ -271,22 +302,23 @@ HeapWord* G1Allocator::survivor_attempt_allocation(size_t min_word_size,
 
 HeapWord* G1Allocator::old_attempt_allocation(size_t min_word_size,
                                               size_t desired_word_size,
-                                              size_t* actual_word_size) {
+                                              size_t* actual_word_size,
+                                              uint node_index) {
   assert(!_g1h->is_humongous(desired_word_size),
          "we should not be seeing humongous-size allocations in this path");
 
-  HeapWord* result = old_gc_alloc_region()->attempt_allocation(min_word_size,
-                                                               desired_word_size,
-                                                               actual_word_size);
+  HeapWord* result = old_gc_alloc_region(node_index)->attempt_allocation(min_word_size,
+                                                                         desired_word_size,
+                                                                         actual_word_size);
   if (result == nullptr && !old_is_full()) {
     MutexLocker x(FreeList_lock, Mutex::_no_safepoint_check_flag);
     // Multiple threads may have queued at the FreeList_lock above after checking whether there
     // actually is still memory available. Redo the check under the lock to avoid unnecessary work;
     // the memory may have been used up as the threads waited to acquire the lock.
     if (!old_is_full()) {
-      result = old_gc_alloc_region()->attempt_allocation_locked(min_word_size,
-                                                                desired_word_size,
-                                                                actual_word_size);
+      result = old_gc_alloc_region(node_index)->attempt_allocation_locked(min_word_size,
+                                                                          desired_word_size,
+                                                                          actual_word_size);
       if (result == nullptr) {
         set_old_full();
       }
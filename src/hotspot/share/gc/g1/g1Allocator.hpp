@@ -46,21 +46,30 @@ class G1Allocator : public CHeapObj<mtGC> {
   bool _survivor_is_full;
   bool _old_is_full;
 
-  // The number of MutatorAllocRegions used, one per memory node.
+  // The number of memory nodes allocation regions are kept for.
   size_t _num_alloc_regions;
 
-  // Alloc region used to satisfy mutator allocation requests.
+  // The number of MutatorAllocRegions per memory node, see G1MutatorAllocRegionStripes.
+  uint _num_mutator_stripes;
+
+  // Alloc regions used to satisfy mutator allocation requests, _num_mutator_stripes
+  // consecutive ones per memory node.
   MutatorAllocRegion* _mutator_alloc_regions;
 
   // Alloc region used to satisfy allocation requests by the GC for
   // survivor objects.
   SurvivorGCAllocRegion* _survivor_gc_alloc_regions;
 
-  // Alloc region used to satisfy allocation requests by the GC for
+  // The number of OldGCAllocRegions used, one per memory node if
+  // G1NUMAAwarePromotion is enabled, one otherwise.
+  uint _num_old_alloc_regions;
+
+  // Alloc regions used to satisfy allocation requests by the GC for
   // old objects.
-  OldGCAllocRegion _old_gc_alloc_region;
+  OldGCAllocRegion* _old_gc_alloc_regions;
 
-  G1HeapRegion* _retained_old_gc_alloc_region;
+  // Old GC alloc regions retained across GCs, one per OldGCAllocRegion.
+  G1HeapRegion** _retained_old_gc_alloc_regions;
 
   bool survivor_is_full() const;
   bool old_is_full() const;
@@ -68,14 +77,19 @@ class G1Allocator : public CHeapObj<mtGC> {
   void set_survivor_full();
   void set_old_full();
 
-  void reuse_retained_old_region(G1EvacInfo* evacuation_info,
-                                 OldGCAllocRegion* old,
-                                 G1HeapRegion** retained);
+  // Returns the number of bytes used in the retained region before reuse, zero
+  // if it could not be reused.
+  size_t reuse_retained_old_region(OldGCAllocRegion* old,
+                                   G1HeapRegion** retained);
+
+  uint num_mutator_alloc_regions() const { return (uint)_num_alloc_regions * _num_mutator_stripes; }
 
   // Accessors to the allocation regions.
-  inline MutatorAllocRegion* mutator_alloc_region(uint node_index);
+  inline MutatorAllocRegion* mutator_alloc_region(uint index);
+  // The mutator alloc region the current thread allocates into on the given node.
+  inline MutatorAllocRegion* current_mutator_alloc_region(uint node_index);
   inline SurvivorGCAllocRegion* survivor_gc_alloc_region(uint node_index);
-  inline OldGCAllocRegion* old_gc_alloc_region();
+  inline OldGCAllocRegion* old_gc_alloc_region(uint node_index);
 
   // Allocation attempt during GC for a survivor object / PLAB.
   HeapWord* survivor_attempt_allocation(size_t min_word_size,
@@ -86,16 +100,20 @@ class G1Allocator : public CHeapObj<mtGC> {
   // Allocation attempt during GC for an old object / PLAB.
   HeapWord* old_attempt_allocation(size_t min_word_size,
                                    size_t desired_word_size,
-                                   size_t* actual_word_size);
+                                   size_t* actual_word_size,
+                                   uint node_index);
 
   // Node index of current thread.
   inline uint current_node_index() const;
+  // Stripe of the current thread within the mutator alloc regions of a node.
+  inline uint current_stripe_index() const;
 
 public:
   G1Allocator(G1CollectedHeap* heap);
   ~G1Allocator();
 
   uint num_nodes() { return (uint)_num_alloc_regions; }
+  uint num_old_alloc_regions() const { return _num_old_alloc_regions; }
 
 #ifdef ASSERT
   // Do we currently have an active mutator region to allocate into?
@@ -188,8 +206,8 @@ class G1PLABAllocator : public CHeapObj<mtGC> {
   inline PLAB* alloc_buffer(region_type_t dest, uint node_index) const;
 
   // Returns the number of allocation buffers for the given dest.
-  // There is only 1 buffer for Old while Young may have multiple buffers depending on
-  // active NUMA nodes.
+  // Young may have multiple buffers depending on active NUMA nodes. There is only
+  // 1 buffer for Old unless G1NUMAAwarePromotion is enabled.
   inline uint alloc_buffers_length(region_type_t dest) const;
 
   bool may_throw_away_buffer(size_t const allocation_word_sz, size_t const buffer_size) const;
@@ -30,14 +30,30 @@
 #include "gc/g1/g1AllocRegion.inline.hpp"
 #include "gc/shared/plab.inline.hpp"
 #include "memory/universe.hpp"
+#include "runtime/thread.hpp"
 
 inline uint G1Allocator::current_node_index() const {
   return _numa->index_of_current_thread();
 }
 
-inline MutatorAllocRegion* G1Allocator::mutator_alloc_region(uint node_index) {
+inline uint G1Allocator::current_stripe_index() const {
+  if (_num_mutator_stripes == 1) {
+    return 0;
+  }
+  // Threads keep their stripe, so that they keep allocating into the same region.
+  uintptr_t hash = (uintptr_t)Thread::current() >> LogHeapWordSize;
+  hash ^= hash >> 16;
+  return (uint)(hash % _num_mutator_stripes);
+}
+
+inline MutatorAllocRegion* G1Allocator::mutator_alloc_region(uint index) {
+  assert(index < num_mutator_alloc_regions(), "Invalid index: %u", index);
+  return &_mutator_alloc_regions[index];
+}
+
+inline MutatorAllocRegion* G1Allocator::current_mutator_alloc_region(uint node_index) {
   assert(node_index < _num_alloc_regions, "Invalid index: %u", node_index);
-  return &_mutator_alloc_regions[node_index];
+  return mutator_alloc_region(node_index * _num_mutator_stripes + current_stripe_index());
 }
 
 inline SurvivorGCAllocRegion* G1Allocator::survivor_gc_alloc_region(uint node_index) {
@@ -45,29 +61,33 @@ inline SurvivorGCAllocRegion* G1Allocator::survivor_gc_alloc_region(uint node_in
   return &_survivor_gc_alloc_regions[node_index];
 }
 
-inline OldGCAllocRegion* G1Allocator::old_gc_alloc_region() {
-  return &_old_gc_alloc_region;
+inline OldGCAllocRegion* G1Allocator::old_gc_alloc_region(uint node_index) {
+  if (_num_old_alloc_regions == 1) {
+    return &_old_gc_alloc_regions[0];
+  }
+  assert(node_index < _num_old_alloc_regions, "Invalid index: %u", node_index);
+  return &_old_gc_alloc_regions[node_index];
 }
 
 inline HeapWord* G1Allocator::attempt_allocation(size_t min_word_size,
                                                  size_t desired_word_size,
                                                  size_t* actual_word_size) {
-  uint node_index = current_node_index();
+  MutatorAllocRegion* alloc_region = current_mutator_alloc_region(current_node_index());
 
-  HeapWord* result = mutator_alloc_region(node_index)->attempt_retained_allocation(min_word_size, desired_word_size, actual_word_size);
+  HeapWord* result = alloc_region->attempt_retained_allocation(min_word_size, desired_word_size, actual_word_size);
   if (result != nullptr) {
     return result;
   }
 
-  return mutator_alloc_region(node_index)->attempt_allocation(min_word_size, desired_word_size, actual_word_size);
+  return alloc_region->attempt_allocation(min_word_size, desired_word_size, actual_word_size);
 }
 
 inline HeapWord* G1Allocator::attempt_allocation_locked(size_t word_size) {
-  uint node_index = current_node_index();
-  HeapWord* result = mutator_alloc_region(node_index)->attempt_allocation_locked(word_size);
+  MutatorAllocRegion* alloc_region = current_mutator_alloc_region(current_node_index());
+  HeapWord* result = alloc_region->attempt_allocation_locked(word_size);
 
-  assert(result != nullptr || mutator_alloc_region(node_index)->get() == nullptr,
-         "Must not have a mutator alloc region if there is no memory, but is " PTR_FORMAT, p2i(mutator_alloc_region(node_index)->get()));
+  assert(result != nullptr || alloc_region->get() == nullptr,
+         "Must not have a mutator alloc region if there is no memory, but is " PTR_FORMAT, p2i(alloc_region->get()));
   return result;
 }
 
@@ -83,7 +103,7 @@ inline PLAB* G1PLABAllocator::alloc_buffer(region_type_t dest, uint node_index)
   assert(dest < G1HeapRegionAttr::Num,
          "Allocation buffer index out of bounds: %u", dest);
 
-  if (dest == G1HeapRegionAttr::Young) {
+  if (dest == G1HeapRegionAttr::Young || alloc_buffers_length(dest) > 1) {
     assert(node_index < alloc_buffers_length(dest),
            "Allocation buffer index out of bounds: %u, %u", dest, node_index);
     return _dest_data[dest]._alloc_buffer[node_index];
@@ -96,7 +116,7 @@ inline uint G1PLABAllocator::alloc_buffers_length(region_type_t dest) const {
   if (dest == G1HeapRegionAttr::Young) {
     return _allocator->num_nodes();
   } else {
-    return 1;
+    return _allocator->num_old_alloc_regions();
   }
 }
 
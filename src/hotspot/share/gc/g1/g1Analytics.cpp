@@ -82,6 +82,7 @@ G1Analytics::G1Analytics(const G1Predictions* predictor) :
     _cost_per_card_merge_ms_seq(TruncatedSeqLength),
     _cost_per_code_root_ms_seq(TruncatedSeqLength),
     _cost_per_byte_copied_ms_seq(TruncatedSeqLength),
+    _copy_cost_model(),
     _pending_cards_seq(TruncatedSeqLength),
     _card_rs_length_seq(TruncatedSeqLength),
     _code_root_rs_length_seq(TruncatedSeqLength),
@@ -201,6 +202,10 @@ void G1Analytics::report_cost_per_byte_ms(double cost_per_byte_ms, bool for_youn
   _cost_per_byte_copied_ms_seq.add(cost_per_byte_ms, for_young_only_phase);
 }
 
+void G1Analytics::report_young_cohort_copy_time_ms(size_t eden_bytes, size_t survivor_bytes, double copy_time_ms) {
+  _copy_cost_model.add_sample(eden_bytes, survivor_bytes, copy_time_ms);
+}
+
 void G1Analytics::report_young_other_cost_per_region_ms(double other_cost_per_region_ms) {
   _young_other_cost_per_region_ms_seq.add(other_cost_per_region_ms);
 }
@@ -265,6 +270,16 @@ double G1Analytics::predict_object_copy_time_ms(size_t bytes_to_copy, bool for_y
   return bytes_to_copy * predict_zero_bounded(&_cost_per_byte_copied_ms_seq, for_young_only_phase);
 }
 
+double G1Analytics::predict_object_copy_time_ms(size_t bytes_to_copy,
+                                                bool for_young_only_phase,
+                                                G1CopyCostModel::Cohort cohort) const {
+  double result = predict_object_copy_time_ms(bytes_to_copy, for_young_only_phase);
+  if (G1UseCohortCopyCostModel) {
+    result *= _copy_cost_model.cost_ratio(cohort);
+  }
+  return result;
+}
+
 double G1Analytics::predict_constant_other_time_ms() const {
   return predict_zero_bounded(&_constant_other_time_ms_seq);
 }
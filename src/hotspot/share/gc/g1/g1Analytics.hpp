@@ -26,6 +26,7 @@
 #define SHARE_GC_G1_G1ANALYTICS_HPP
 
 #include "gc/g1/g1AnalyticsSequences.hpp"
+#include "gc/g1/g1CopyCostModel.hpp"
 #include "memory/allocation.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -61,6 +62,8 @@ class G1Analytics: public CHeapObj<mtGC> {
   G1PhaseDependentSeq _cost_per_code_root_ms_seq;
   // The cost to copy a byte in ms.
   G1PhaseDependentSeq _cost_per_byte_copied_ms_seq;
+  // Relative cost to copy a byte from the young generation survival cohorts.
+  G1CopyCostModel _copy_cost_model;
 
   G1PhaseDependentSeq _pending_cards_seq;
   G1PhaseDependentSeq _card_rs_length_seq;
@@ -133,6 +136,7 @@ class G1Analytics: public CHeapObj<mtGC> {
   void report_cost_per_code_root_scan_ms(double cost_per_code_root_ms, bool for_young_only_phase);
   void report_card_scan_to_merge_ratio(double cards_per_entry_ratio, bool for_young_only_phase);
   void report_cost_per_byte_ms(double cost_per_byte_ms, bool for_young_only_phase);
+  void report_young_cohort_copy_time_ms(size_t eden_bytes, size_t survivor_bytes, double copy_time_ms);
   void report_young_other_cost_per_region_ms(double other_cost_per_region_ms);
   void report_non_young_other_cost_per_region_ms(double other_cost_per_region_ms);
   void report_constant_other_time_ms(double constant_other_time_ms);
@@ -157,6 +161,11 @@ class G1Analytics: public CHeapObj<mtGC> {
   double predict_code_root_scan_time_ms(size_t code_root_num, bool for_young_only_phase) const;
 
   double predict_object_copy_time_ms(size_t bytes_to_copy, bool for_young_only_phase) const;
+  // Predict the object copy time for bytes from the given young generation survival
+  // cohort. Only differs from above if G1UseCohortCopyCostModel is enabled.
+  double predict_object_copy_time_ms(size_t bytes_to_copy,
+                                     bool for_young_only_phase,
+                                     G1CopyCostModel::Cohort cohort) const;
 
   double predict_constant_other_time_ms() const;
 
@@ -185,6 +185,22 @@ void G1Arguments::initialize() {
     FLAG_SET_ERGO(G1ConcRefinementThreads, ParallelGCThreads);
   }
 
+#if !defined(X86) && !defined(ZERO)
+  if (G1UseCardTableRefinement) {
+    log_warning(gc, ergo)("G1UseCardTableRefinement is not supported on this platform");
+    FLAG_SET_DEFAULT(G1UseCardTableRefinement, false);
+  }
+#endif
+
+#if INCLUDE_JVMCI
+  // JVMCI compilers emit their own post-barrier, which logs dirty cards
+  // through G1BarrierSetRuntime::write_ref_field_post_entry.
+  if (G1UseCardTableRefinement && EnableJVMCI) {
+    log_warning(gc, ergo)("G1UseCardTableRefinement is not supported with -XX:+EnableJVMCI");
+    FLAG_SET_ERGO(G1UseCardTableRefinement, false);
+  }
+#endif
+
   if (FLAG_IS_DEFAULT(ConcGCThreads) || ConcGCThreads == 0) {
     // Calculate the number of concurrent worker threads by scaling
     // the number of parallel GC threads.
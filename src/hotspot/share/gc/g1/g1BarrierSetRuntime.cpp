@@ -58,6 +58,7 @@ JRT_END
 JRT_LEAF(void, G1BarrierSetRuntime::write_ref_field_post_entry(volatile G1CardTable::CardValue* card_addr,
                                                                JavaThread* thread))
   assert(thread == JavaThread::current(), "pre-condition");
+  assert(!G1UseCardTableRefinement, "compiled barriers must not log cards");
   G1DirtyCardQueue& queue = G1ThreadLocalData::dirty_card_queue(thread);
   G1BarrierSet::dirty_card_queue_set().enqueue(queue, card_addr);
 JRT_END
@@ -976,6 +976,67 @@ void G1CardSet::iterate_cards(CardClosure& cl) {
   iterate_containers(&cl2);
 }
 
+// Accumulates an order-independent hash over the cards of a container; array
+// containers do not keep their cards sorted.
+class G1ContainerFingerprintClosure {
+  uint64_t _sum;
+  uint64_t _xor;
+
+  static uint64_t mix(uint64_t v) {
+    v ^= v >> 33;
+    v *= UCONST64(0xff51afd7ed558ccd);
+    v ^= v >> 33;
+    v *= UCONST64(0xc4ceb9fe1a85ec53);
+    v ^= v >> 33;
+    return v;
+  }
+
+public:
+  G1ContainerFingerprintClosure() : _sum(0), _xor(0) { }
+
+  bool start_iterate(uint tag) { return true; }
+
+  void operator()(uint card_idx) {
+    uint64_t h = mix((uint64_t)card_idx + 1);
+    _sum += h;
+    _xor ^= mix(h);
+  }
+
+  void operator()(uint card_idx, uint length) {
+    for (uint i = 0; i < length; i++) {
+      (*this)(card_idx + i);
+    }
+  }
+
+  uint64_t value() const { return _sum ^ (_xor * UCONST64(0x9e3779b97f4a7c15)); }
+};
+
+void G1CardSet::iterate_container_fingerprints(ContainerFingerprintClosure* cl, bool at_safepoint) {
+  class FingerprintContainers : public ContainerPtrClosure {
+    G1CardSet* _card_set;
+    ContainerFingerprintClosure* _cl;
+
+  public:
+    FingerprintContainers(G1CardSet* card_set, ContainerFingerprintClosure* cl) :
+      _card_set(card_set), _cl(cl) { }
+
+    void do_containerptr(uint card_region_idx, size_t num_occupied, ContainerPtr container) override {
+      uintptr_t type = container_type(container);
+      if (type == ContainerInlinePtr || container == FullCardSet) {
+        // No separate memory that could be shared.
+        return;
+      }
+      G1ContainerFingerprintClosure fp;
+      _card_set->iterate_cards_or_ranges_in_container(container, fp);
+      uint mem_object_type = _card_set->container_type_to_mem_object_type(type);
+      size_t mem_size = _card_set->_config->mem_object_alloc_options(mem_object_type)->slot_size();
+      _cl->do_fingerprint(card_region_idx, (uint)type, num_occupied, fp.value(), mem_size);
+    }
+  } cl2(this, cl);
+
+  iterate_containers(&cl2, at_safepoint);
+}
+
 bool G1CardSet::occupancy_less_or_equal_to(size_t limit) const {
   return occupied() <= limit;
 }
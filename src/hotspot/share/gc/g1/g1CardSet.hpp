@@ -403,6 +403,23 @@ class G1CardSet : public CHeapObj<mtGCCardSet> {
   };
 
   void iterate_containers(ContainerPtrClosure* cl, bool safepoint = false);
+
+  // Receives a content fingerprint for every container that occupies its own
+  // memory, i.e. excluding inline pointers and full containers. Two containers
+  // with the same card region, type, occupancy and hash very likely contain the
+  // same cards.
+  class ContainerFingerprintClosure {
+  public:
+    virtual void do_fingerprint(uint card_region_idx,
+                                uint container_type,
+                                size_t num_occupied,
+                                uint64_t hash,
+                                size_t container_mem_size) = 0;
+  };
+
+  // Diagnostic: computes an order-independent fingerprint of the cards in each
+  // container. Visits every card, so only intended for statistics printing.
+  void iterate_container_fingerprints(ContainerFingerprintClosure* cl, bool safepoint = false);
 };
 
 class G1CardSetHashTableValue {
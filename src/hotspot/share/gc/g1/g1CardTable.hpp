@@ -105,6 +105,11 @@ class G1CardTable : public CardTable {
   // Change the given range of dirty cards to "which". All of these cards must be Dirty.
   inline void change_dirty_cards_to(CardValue* start_card, CardValue* end_card, CardValue which);
 
+  // Returns the first Dirty card in [start_card, end_card), or end_card if there
+  // is none. Examines a word of cards at a time where possible, as most cards are
+  // expected to be non-Dirty.
+  inline CardValue* find_first_dirty_card(CardValue* start_card, CardValue* end_card) const;
+
   inline uint region_idx_for(CardValue* p);
 
   static size_t compute_size(size_t mem_region_size_in_words) {
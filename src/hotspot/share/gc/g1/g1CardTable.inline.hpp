@@ -81,4 +81,33 @@ inline void G1CardTable::change_dirty_cards_to(CardValue* start_card, CardValue*
   }
 }
 
+inline G1CardTable::CardValue* G1CardTable::find_first_dirty_card(CardValue* start_card, CardValue* end_card) const {
+  STATIC_ASSERT(dirty_card == 0);
+  // Per-byte constants to detect a zero (i.e. Dirty) byte in a word.
+  const size_t low_bits = SIZE_MAX / 255;
+  const size_t high_bits = low_bits << (BitsPerByte - 1);
+
+  CardValue* cur = start_card;
+  while (cur < end_card && !is_aligned(cur, sizeof(size_t))) {
+    if (*cur == dirty_card_val()) {
+      return cur;
+    }
+    cur++;
+  }
+  while (cur + sizeof(size_t) <= end_card) {
+    size_t value = *(size_t*)cur;
+    if (((value - low_bits) & ~value & high_bits) != 0) {
+      break;
+    }
+    cur += sizeof(size_t);
+  }
+  while (cur < end_card) {
+    if (*cur == dirty_card_val()) {
+      return cur;
+    }
+    cur++;
+  }
+  return end_card;
+}
+
 #endif /* SHARE_GC_G1_G1CARDTABLE_INLINE_HPP */
@@ -55,6 +55,7 @@
 #include "gc/g1/g1HeapVerifier.hpp"
 #include "gc/g1/g1InitLogger.hpp"
 #include "gc/g1/g1MemoryPool.hpp"
+#include "gc/g1/g1MemoryPressureUncommitTask.hpp"
 #include "gc/g1/g1MonotonicArenaFreeMemoryTask.hpp"
 #include "gc/g1/g1OopClosures.inline.hpp"
 #include "gc/g1/g1ParallelCleaning.hpp"
@@ -1070,6 +1071,25 @@ void G1CollectedHeap::shrink(size_t shrink_bytes) {
   _verifier->verify_region_sets_optional();
 }
 
+uint G1CollectedHeap::shrink_for_memory_pressure() {
+  assert_heap_locked_and_not_at_safepoint();
+
+  uint num_regions_to_remove = _heap_sizing_policy->memory_pressure_shrink_regions();
+  if (num_regions_to_remove == 0) {
+    log_debug(gc, ergo, heap)("Did not shrink the heap under memory pressure (no excess free regions)");
+    return 0;
+  }
+
+  uint num_regions_removed = _hrm.shrink_free_regions_by(num_regions_to_remove);
+  log_debug(gc, ergo, heap)("Shrink the heap under memory pressure. requested: %u regions removed: %u regions",
+                            num_regions_to_remove, num_regions_removed);
+  if (num_regions_removed > 0) {
+    policy()->record_new_heap_size(num_regions());
+    G1UncommitRegionTask::enqueue();
+  }
+  return num_regions_removed;
+}
+
 class OldRegionSetChecker : public HeapRegionSetChecker {
 public:
   void check_mt_safety() {
@@ -1292,6 +1312,7 @@ jint G1CollectedHeap::initialize() {
     G1SATBMarkQueueSet& satbqs = bs->satb_mark_queue_set();
     satbqs.set_process_completed_buffers_threshold(G1SATBProcessCompletedThreshold);
     satbqs.set_buffer_enqueue_threshold_percentage(G1SATBBufferEnqueueingThresholdPercent);
+    satbqs.set_filter_before_enqueue(G1SATBFilterBeforeEnqueue);
   }
 
   // Create space mappers.
@@ -1403,6 +1424,10 @@ jint G1CollectedHeap::initialize() {
   _free_arena_memory_task = new G1MonotonicArenaFreeMemoryTask("Card Set Free Memory Task");
   _service_thread->register_task(_free_arena_memory_task);
 
+  if (G1MemoryPressureUncommitInterval > 0) {
+    _service_thread->register_task(new G1MemoryPressureUncommitTask("Memory Pressure Uncommit Task"));
+  }
+
   // Here we allocate the dummy G1HeapRegion that is required by the
   // G1AllocRegion class.
   G1HeapRegion* dummy_region = _hrm.get_dummy_region();
@@ -2286,6 +2311,10 @@ bool G1CollectedHeap::is_potential_eager_reclaim_candidate(G1HeapRegion* r) cons
   return rem_set->occupancy_less_or_equal_than(G1EagerReclaimRemSetThreshold);
 }
 
+bool G1CollectedHeap::is_eager_reclaim_kind(oop obj) {
+  return obj->is_typeArray() || (G1EagerReclaimHumongousObjArrays && obj->is_objArray());
+}
+
 #ifndef PRODUCT
 void G1CollectedHeap::verify_region_attr_remset_is_tracked() {
   class VerifyRegionAttrRemSet : public HeapRegionClosure {
@@ -595,6 +595,9 @@ class G1CollectedHeap : public CollectedHeap {
   // Does the given region fulfill remembered set based eager reclaim candidate requirements?
   bool is_potential_eager_reclaim_candidate(G1HeapRegion* r) const;
 
+  // Is the given humongous object of a kind that may be eagerly reclaimed?
+  static bool is_eager_reclaim_kind(oop obj);
+
   inline bool is_humongous_reclaim_candidate(uint region);
 
   // Remove from the reclaim candidate set.  Also remove from the
@@ -729,6 +732,15 @@ class G1CollectedHeap : public CollectedHeap {
   void shrink(size_t shrink_bytes);
   void shrink_helper(size_t expand_bytes);
 
+public:
+  // Shrink the heap by the free regions not expected to be needed until the
+  // next collection, outside of a safepoint. The caller must hold the Heap_lock
+  // and be joined to the suspendible thread set. Returns the number of regions
+  // that will be uncommitted.
+  uint shrink_for_memory_pressure();
+
+private:
+
   // Schedule the VM operation that will do an evacuation pause to
   // satisfy an allocation request of word_size. *succeeded will
   // return whether the VM operation was successful (it did do an
@@ -36,8 +36,10 @@
 #include "logging/log.hpp"
 #include "memory/memRegion.hpp"
 #include "oops/oopsHierarchy.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/quickSort.hpp"
 
 // Worker task that scans the objects in the old generation to rebuild the remembered
 // set and at the same time scrubs dead objects by replacing them with filler objects
@@ -63,7 +65,18 @@
 // a pause.
 class G1RebuildRSAndScrubTask : public WorkerTask {
   G1ConcurrentMark* _cm;
-  HeapRegionClaimer _hr_claimer;
+
+  struct RegionWork {
+    uint _region_idx;
+    size_t _words;
+  };
+
+  // Regions to process ordered by decreasing amount of work so that the largest
+  // work items are started first. This reduces the time until the last worker
+  // finishes compared to claiming the regions in heap order.
+  RegionWork* _regions;
+  uint _num_regions;
+  volatile uint _next_region;
 
   const bool _should_rebuild_remset;
 
@@ -326,25 +339,96 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
     }
   };
 
+  // Collects the regions that need to be scrubbed or scanned with the amount of
+  // work, i.e. the words up to top_at_rebuild_start.
+  class G1CollectRegionWorkClosure : public HeapRegionClosure {
+    G1ConcurrentMark* _cm;
+    RegionWork* _regions;
+    uint _num_regions;
+
+  public:
+    G1CollectRegionWorkClosure(G1ConcurrentMark* cm, RegionWork* regions) :
+      _cm(cm), _regions(regions), _num_regions(0) { }
+
+    bool do_heap_region(G1HeapRegion* hr) {
+      HeapWord* tars = _cm->top_at_rebuild_start(hr);
+      if (tars != nullptr) {
+        _regions[_num_regions]._region_idx = hr->hrm_index();
+        _regions[_num_regions]._words = pointer_delta(tars, hr->bottom());
+        _num_regions++;
+      }
+      return false;
+    }
+
+    uint num_regions() const { return _num_regions; }
+  };
+
+  static int compare_region_work(RegionWork a, RegionWork b) {
+    if (a._words > b._words) {
+      return -1;
+    } else if (a._words < b._words) {
+      return 1;
+    }
+    // Keep heap order for equal amounts of work.
+    return (a._region_idx < b._region_idx) ? -1 : (a._region_idx > b._region_idx ? 1 : 0);
+  }
+
+  bool claim_next_region(uint* region_idx) {
+    if (Atomic::load(&_next_region) >= _num_regions) {
+      return false;
+    }
+    uint claimed = Atomic::fetch_then_add(&_next_region, 1u);
+    if (claimed >= _num_regions) {
+      return false;
+    }
+    *region_idx = _regions[claimed]._region_idx;
+    return true;
+  }
+
 public:
-  G1RebuildRSAndScrubTask(G1ConcurrentMark* cm, bool should_rebuild_remset, uint num_workers) :
+  G1RebuildRSAndScrubTask(G1ConcurrentMark* cm, bool should_rebuild_remset) :
     WorkerTask("Scrub dead objects"),
     _cm(cm),
-    _hr_claimer(num_workers),
-    _should_rebuild_remset(should_rebuild_remset) { }
+    _regions(nullptr),
+    _num_regions(0),
+    _next_region(0),
+    _should_rebuild_remset(should_rebuild_remset) {
+
+    G1CollectedHeap* g1h = G1CollectedHeap::heap();
+    _regions = NEW_C_HEAP_ARRAY(RegionWork, g1h->max_reserved_regions(), mtGC);
+
+    // Region availability must not change while looking at them.
+    SuspendibleThreadSetJoiner sts_join;
+    G1CollectRegionWorkClosure cl(_cm, _regions);
+    g1h->heap_region_iterate(&cl);
+    _num_regions = cl.num_regions();
+    QuickSort::sort(_regions, _num_regions, compare_region_work);
+  }
+
+  ~G1RebuildRSAndScrubTask() {
+    FREE_C_HEAP_ARRAY(RegionWork, _regions);
+  }
 
   void work(uint worker_id) {
     SuspendibleThreadSetJoiner sts_join;
 
     G1CollectedHeap* g1h = G1CollectedHeap::heap();
     G1RebuildRSAndScrubRegionClosure cl(_cm, _should_rebuild_remset, worker_id);
-    g1h->heap_region_par_iterate_from_worker_offset(&cl, &_hr_claimer, worker_id);
+    uint region_idx;
+    while (claim_next_region(&region_idx)) {
+      // The region may have been reclaimed and uncommitted in a safepoint
+      // since the list had been created.
+      G1HeapRegion* hr = g1h->region_at_or_null(region_idx);
+      if (hr != nullptr && cl.do_heap_region(hr)) {
+        break;
+      }
+    }
   }
 };
 
 void G1ConcurrentRebuildAndScrub::rebuild_and_scrub(G1ConcurrentMark* cm, bool should_rebuild_remset, WorkerThreads* workers) {
   uint num_workers = workers->active_workers();
 
-  G1RebuildRSAndScrubTask task(cm, should_rebuild_remset, num_workers);
+  G1RebuildRSAndScrubTask task(cm, should_rebuild_remset);
   workers->run_task(&task, num_workers);
 }
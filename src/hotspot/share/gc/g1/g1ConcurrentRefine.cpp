@@ -24,6 +24,8 @@
 
 #include "precompiled.hpp"
 #include "gc/g1/g1BarrierSet.hpp"
+#include "gc/g1/g1CardTable.inline.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1CollectionSet.hpp"
 #include "gc/g1/g1ConcurrentRefine.hpp"
 #include "gc/g1/g1ConcurrentRefineThread.hpp"
@@ -31,12 +33,15 @@
 #include "gc/g1/g1HeapRegion.inline.hpp"
 #include "gc/g1/g1HeapRegionRemSet.inline.hpp"
 #include "gc/g1/g1Policy.hpp"
+#include "gc/g1/g1RemSet.hpp"
 #include "gc/shared/gc_globals.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/iterator.hpp"
 #include "runtime/java.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/orderAccess.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include <math.h>
@@ -151,7 +156,8 @@ G1ConcurrentRefine::G1ConcurrentRefine(G1Policy* policy) :
   _needs_adjust(false),
   _threads_needed(policy, adjust_threads_period_ms()),
   _thread_control(G1ConcRefinementThreads),
-  _dcqs(G1BarrierSet::dirty_card_queue_set())
+  _dcqs(G1BarrierSet::dirty_card_queue_set()),
+  _sweep_cursor(SweepNotActive)
 {}
 
 jint G1ConcurrentRefine::initialize() {
@@ -211,6 +217,10 @@ void G1ConcurrentRefine::adjust_after_gc(double logged_cards_time_ms,
                                          double goal_ms) {
   if (!G1UseConcRefinement) return;
 
+  // The GC merged and cleared all dirty cards from the card table, so any
+  // sweep in progress is moot.
+  Atomic::store(&_sweep_cursor, SweepNotActive);
+
   update_pending_cards_target(logged_cards_time_ms,
                               processed_logged_cards,
                               predicted_thread_buffer_cards,
@@ -316,6 +326,9 @@ bool G1ConcurrentRefine::adjust_threads_periodically() {
     if (Heap_lock->try_lock()) {
       size_t used_bytes = _policy->estimate_used_young_bytes_locked();
       Heap_lock->unlock();
+      if (G1UseCardTableRefinement && !is_sweep_active()) {
+        start_sweep();
+      }
       adjust_young_list_target_length();
       size_t young_bytes = _policy->young_list_target_length() * G1HeapRegion::GrainBytes;
       size_t available_bytes = young_bytes - MIN2(young_bytes, used_bytes);
@@ -344,6 +357,10 @@ void G1ConcurrentRefine::adjust_threads_wanted(size_t available_bytes) {
                          num_cards,
                          _pending_cards_target);
   uint new_wanted = _threads_needed.threads_needed();
+  if (is_sweep_active()) {
+    // Make sure the primary thread stays active to complete the sweep.
+    new_wanted = MAX2(new_wanted, 1u);
+  }
   if (new_wanted > _thread_control.max_num_threads()) {
     // If running all the threads can't reach goal, turn on refinement by
     // mutator threads.  Using target as the threshold may be stronger
@@ -432,5 +449,99 @@ bool G1ConcurrentRefine::try_refinement_step(uint worker_id,
                                              size_t stop_at,
                                              G1ConcurrentRefineStats* stats) {
   uint adjusted_id = worker_id + worker_id_offset();
-  return _dcqs.refine_completed_buffer_concurrently(adjusted_id, stop_at, stats);
+  if (_dcqs.refine_completed_buffer_concurrently(adjusted_id, stop_at, stats)) {
+    return true;
+  }
+  return G1UseCardTableRefinement && try_sweep_step(adjusted_id, stats);
+}
+
+bool G1ConcurrentRefine::is_sweep_active() const {
+  return Atomic::load(&_sweep_cursor) < G1CollectedHeap::heap()->max_reserved_regions();
+}
+
+void G1ConcurrentRefine::start_sweep() {
+  assert_current_thread_is_primary_refinement_thread();
+  log_trace(gc, refine)("Start card table sweep");
+  Atomic::store(&_sweep_cursor, 0u);
+}
+
+// Sweep the card table of the next region of the current sweep for dirty cards
+// and refine them. Returns false if there is no sweep in progress or all its
+// regions have already been claimed.
+bool G1ConcurrentRefine::try_sweep_step(uint worker_id, G1ConcurrentRefineStats* stats) {
+  using CardValue = G1CardTable::CardValue;
+
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  // Check before claiming to keep the cursor from overflowing while idle
+  // threads repeatedly try to find work.
+  if (!is_sweep_active()) {
+    return false;
+  }
+  uint region_idx = Atomic::fetch_then_add(&_sweep_cursor, 1u);
+  if (region_idx >= g1h->max_reserved_regions()) {
+    return false;
+  }
+
+  // Free regions may be committed, uncommitted or allocated as humongous
+  // concurrently, so this check only filters out regions without cards to
+  // refine; clean_card_before_refine() rechecks the region of every dirty card.
+  // Old and humongous regions are only freed at a safepoint, and refinement
+  // threads are part of the suspendible thread set, so the card range below
+  // stays committed while this step runs.
+  G1HeapRegion* r = g1h->region_at_or_null(region_idx);
+  if (r == nullptr || !r->is_old_or_humongous()) {
+    return true;
+  }
+  HeapWord* const top = r->top();
+  if (top == r->bottom()) {
+    return true;
+  }
+
+  Ticks start_time = Ticks::now();
+
+  G1CardTable* ct = g1h->card_table();
+  G1RemSet* rem_set = g1h->rem_set();
+
+  CardValue* const start = ct->byte_for(r->bottom());
+  CardValue* const end = ct->byte_for(top - 1) + 1;
+
+  const size_t BatchSize = 128;
+  CardValue* batch[BatchSize];
+  size_t batch_length = 0;
+  size_t num_dirty = 0;
+
+  CardValue* cur = start;
+  while (true) {
+    cur = ct->find_first_dirty_card(cur, end);
+    if (cur < end) {
+      num_dirty++;
+      CardValue* card_ptr = cur++;
+      // Cleans the card if it needs refinement.
+      if (rem_set->clean_card_before_refine(&card_ptr)) {
+        batch[batch_length++] = card_ptr;
+      }
+    }
+    bool done = (cur == end);
+    if (batch_length == BatchSize || (done && batch_length > 0)) {
+      // Make sure the mutators see the cleaned cards before examining the
+      // card contents, see G1RefineBufferedCards::refine().
+      OrderAccess::fence();
+      for (size_t i = 0; i < batch_length; i++) {
+        rem_set->refine_card_concurrently(batch[i], worker_id);
+      }
+      stats->inc_refined_cards(batch_length);
+      batch_length = 0;
+      // Leave the rest of the region for the GC or the next sweep.
+      done = done || SuspendibleThreadSet::should_yield();
+    }
+    if (done) {
+      break;
+    }
+  }
+
+  stats->inc_swept_cards(pointer_delta(cur, start, sizeof(CardValue)));
+  // The mutators did not record the cards they dirtied, so count the ones found.
+  stats->inc_dirtied_cards(num_dirty);
+  stats->inc_refinement_time(Ticks::now() - start_time);
+  return true;
 }
@@ -101,6 +101,13 @@ class G1ConcurrentRefineThreadControl {
 // them.  Between buffers they query this owning object to find out whether
 // they should continue running, deactivating themselves if not.
 //
+// With -XX:+G1UseCardTableRefinement mutator threads only dirty cards in the
+// card table and do not log them.  Refinement threads then find these cards
+// by sweeping the card table of old and humongous regions, one region per
+// refinement step.  The primary thread starts a new sweep whenever the
+// previous one has completed and it performs a periodic adjustment.  Cards
+// left dirty at the start of a GC are merged from the card table by the GC.
+//
 // The primary thread drives the control system that determines how many
 // refinement threads should be active.  If inactive, it wakes up periodically
 // to recalculate the number of active threads needed, and activates
@@ -118,6 +125,10 @@ class G1ConcurrentRefine : public CHeapObj<mtGC> {
   G1ConcurrentRefineThreadsNeeded _threads_needed;
   G1ConcurrentRefineThreadControl _thread_control;
   G1DirtyCardQueueSet& _dcqs;
+  // Index of the next region to examine in the current card table sweep.
+  // Values at or beyond the number of reserved regions indicate that no sweep
+  // is in progress.
+  volatile uint _sweep_cursor;
 
   G1ConcurrentRefine(G1Policy* policy);
 
@@ -151,6 +162,12 @@ class G1ConcurrentRefine : public CHeapObj<mtGC> {
 
   void adjust_threads_wanted(size_t available_bytes);
 
+  // Card table sweeping support for G1UseCardTableRefinement.
+  static const uint SweepNotActive = UINT_MAX;
+  bool is_sweep_active() const;
+  void start_sweep();
+  bool try_sweep_step(uint worker_id, G1ConcurrentRefineStats* stats);
+
   NONCOPYABLE(G1ConcurrentRefine);
 
 public:
@@ -210,6 +227,8 @@ class G1ConcurrentRefine : public CHeapObj<mtGC> {
 
   // Perform a single refinement step; called by the refinement
   // threads.  Returns true if there was refinement work available.
+  // If there are no completed buffers to process, sweeps part of the card
+  // table when using G1UseCardTableRefinement.
   // Updates stats.
   bool try_refinement_step(uint worker_id,
                            size_t stop_at,
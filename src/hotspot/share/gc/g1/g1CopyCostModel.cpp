@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CopyCostModel.hpp"
+#include "utilities/debug.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+G1CopyCostModel::G1CopyCostModel(double decay) :
+  _decay(decay),
+  _sum_ee(0.0),
+  _sum_es(0.0),
+  _sum_ss(0.0),
+  _sum_et(0.0),
+  _sum_st(0.0),
+  _num_samples(0),
+  _has_estimate(false) {
+  assert(decay > 0.0 && decay < 1.0, "decay %f must be in (0, 1)", decay);
+  for (uint i = 0; i < NumCohorts; i++) {
+    _sum_bytes[i] = 0.0;
+    _cost_ratio[i] = 1.0;
+  }
+}
+
+void G1CopyCostModel::add_sample(size_t eden_bytes, size_t survivor_bytes, double copy_time_ms) {
+  if (eden_bytes + survivor_bytes == 0 || copy_time_ms <= 0.0) {
+    return;
+  }
+
+  double const e = (double)eden_bytes / M;
+  double const s = (double)survivor_bytes / M;
+
+  _sum_ee = _decay * _sum_ee + e * e;
+  _sum_es = _decay * _sum_es + e * s;
+  _sum_ss = _decay * _sum_ss + s * s;
+  _sum_et = _decay * _sum_et + e * copy_time_ms;
+  _sum_st = _decay * _sum_st + s * copy_time_ms;
+  _sum_bytes[Eden] = _decay * _sum_bytes[Eden] + e;
+  _sum_bytes[Survivor] = _decay * _sum_bytes[Survivor] + s;
+  _num_samples++;
+
+  update_cost_ratios();
+}
+
+void G1CopyCostModel::update_cost_ratios() {
+  _has_estimate = false;
+  for (uint i = 0; i < NumCohorts; i++) {
+    _cost_ratio[i] = 1.0;
+  }
+
+  if (_num_samples < MinSamples) {
+    return;
+  }
+
+  // If the cohort mix has been (almost) the same in all samples the system is
+  // ill-conditioned and the costs can not be told apart. Correlation between
+  // eden and survivor bytes must be sufficiently below one.
+  double const det = _sum_ee * _sum_ss - _sum_es * _sum_es;
+  if (det <= 0.01 * _sum_ee * _sum_ss) {
+    return;
+  }
+
+  double const cost_eden = (_sum_et * _sum_ss - _sum_st * _sum_es) / det;
+  double const cost_survivor = (_sum_st * _sum_ee - _sum_et * _sum_es) / det;
+  if (cost_eden <= 0.0 || cost_survivor <= 0.0) {
+    return;
+  }
+
+  double const total_bytes = _sum_bytes[Eden] + _sum_bytes[Survivor];
+  double const avg_cost = (cost_eden * _sum_bytes[Eden] + cost_survivor * _sum_bytes[Survivor]) / total_bytes;
+
+  _cost_ratio[Eden] = clamp(cost_eden / avg_cost, MinCostRatio, MaxCostRatio);
+  _cost_ratio[Survivor] = clamp(cost_survivor / avg_cost, MinCostRatio, MaxCostRatio);
+  _has_estimate = true;
+}
+
+double G1CopyCostModel::cost_ratio(Cohort cohort) const {
+  assert(cohort < NumCohorts, "invalid cohort %d", cohort);
+  return _cost_ratio[cohort];
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1COPYCOSTMODEL_HPP
+#define SHARE_GC_G1_G1COPYCOSTMODEL_HPP
+
+#include "memory/allocation.hpp"
+
+// Estimates how the cost of copying a byte differs between the survival
+// cohorts of the young generation, i.e. objects evacuated from eden regions
+// (age zero) and objects evacuated from survivor regions.
+//
+// Every young-only pause provides one sample of the total object copy time and
+// the number of bytes copied from each cohort. The model fits
+//
+//   copy time = cost_eden * eden bytes + cost_survivor * survivor bytes
+//
+// using least squares over exponentially decaying sums of the samples, so that
+// it follows changes of the application behavior. The fit is only used if the
+// cohort mix varies enough between samples to tell the costs apart.
+//
+// Results are provided as ratio of the cohort cost to the average cost of the
+// recently copied bytes. This allows callers to scale an existing (conservative)
+// cost per byte prediction. The ratio is one if there is no usable fit.
+class G1CopyCostModel {
+public:
+  enum Cohort {
+    Eden,
+    Survivor,
+    NumCohorts
+  };
+
+private:
+  // Weight of the previous sums when adding a sample.
+  double const _decay;
+
+  // Decayed sums for the normal equations. Bytes are in MB to keep magnitudes
+  // reasonable.
+  double _sum_ee;
+  double _sum_es;
+  double _sum_ss;
+  double _sum_et;
+  double _sum_st;
+  // Decayed byte totals per cohort to compute the average cost.
+  double _sum_bytes[NumCohorts];
+
+  uint _num_samples;
+
+  bool _has_estimate;
+  double _cost_ratio[NumCohorts];
+
+  void update_cost_ratios();
+
+public:
+  // Minimum number of samples before the fit is used.
+  static const uint MinSamples = 5;
+  // Bounds for the cost ratio, guarding against bad fits.
+  static constexpr double MinCostRatio = 0.25;
+  static constexpr double MaxCostRatio = 4.0;
+
+  G1CopyCostModel(double decay = 0.9);
+
+  void add_sample(size_t eden_bytes, size_t survivor_bytes, double copy_time_ms);
+
+  // Returns whether the fit is currently used.
+  bool has_estimate() const { return _has_estimate; }
+
+  // Ratio of the cost per byte for the given cohort to the average over recently
+  // copied bytes. One if there is no estimate.
+  double cost_ratio(Cohort cohort) const;
+};
+
+#endif // SHARE_GC_G1_G1COPYCOSTMODEL_HPP
@@ -422,6 +422,9 @@ void G1FullCollector::phase2c_prepare_serial_compaction() {
   G1HeapRegion* start_hr = _heap->region_at(start_serial);
   serial_cp->add(start_hr);
   serial_cp->initialize(start_hr);
+  // The objects in the first region keep their destinations from parallel
+  // preparation, within that region or in regions compacted before.
+  serial_cp->record_destination_range(0);
 
   HeapWord* dense_prefix_top = compaction_top(start_hr);
   G1SerialRePrepareClosure re_prepare(serial_cp, dense_prefix_top);
@@ -431,7 +434,11 @@ void G1FullCollector::phase2c_prepare_serial_compaction() {
       G1HeapRegion* current = _heap->region_at(i);
       set_compaction_top(current, current->bottom());
       serial_cp->add(current);
+      uint first_destination = serial_cp->current_position();
+      re_prepare.reset_skipped_dense_prefix_objects();
       current->apply_to_marked_objects(mark_bitmap(), &re_prepare);
+      // Skipped objects may be compacted into the first region.
+      serial_cp->record_destination_range(re_prepare.skipped_dense_prefix_objects() ? 0 : first_destination);
     }
   }
   serial_cp->update();
@@ -486,9 +493,12 @@ void G1FullCollector::phase4_do_compaction() {
   G1FullGCCompactTask task(this);
   run_task(&task);
 
-  // Serial compact to avoid OOM when very few free regions.
+  // Maximally compact the tail regions in a single compaction queue to avoid
+  // OOM when very few free regions.
   if (serial_compaction_point()->has_regions()) {
-    task.serial_compaction();
+    GCTraceTime(Debug, gc, phases) debug("Phase 4: Serial Compaction", scope()->timer());
+    G1FullGCCompactTask serial_task(this, serial_compaction_point());
+    run_task(&serial_task);
   }
 
   if (!_humongous_compaction_regions.is_empty()) {
@@ -32,6 +32,8 @@
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "logging/log.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
 #include "utilities/ticks.hpp"
 
 void G1FullGCCompactTask::G1CompactRegionClosure::clear_in_bitmap(oop obj) {
@@ -85,24 +87,108 @@ void G1FullGCCompactTask::compact_region(G1HeapRegion* hr) {
   hr->reset_compacted_after_full_gc(_collector->compaction_top(hr));
 }
 
-void G1FullGCCompactTask::work(uint worker_id) {
-  Ticks start = Ticks::now();
-  GrowableArray<G1HeapRegion*>* compaction_queue = collector()->compaction_point(worker_id)->regions();
-  for (GrowableArrayIterator<G1HeapRegion*> it = compaction_queue->begin();
-       it != compaction_queue->end();
-       ++it) {
-    compact_region(*it);
+G1FullGCCompactTask::CompactionQueue::~CompactionQueue() {
+  FREE_C_HEAP_ARRAY(bool, _compacted);
+}
+
+void G1FullGCCompactTask::CompactionQueue::initialize(G1FullGCCompactionPoint* cp) {
+  assert(_cp == nullptr, "initialize only once");
+  assert(!cp->has_regions() || cp->has_destination_ranges(), "destination ranges must be complete");
+  _cp = cp;
+  _length = (uint)cp->regions()->length();
+  _compacted = NEW_C_HEAP_ARRAY(bool, _length, mtGC);
+  for (uint i = 0; i < _length; i++) {
+    _compacted[i] = false;
   }
 }
 
-void G1FullGCCompactTask::serial_compaction() {
-  GCTraceTime(Debug, gc, phases) tm("Phase 4: Serial Compaction", collector()->scope()->timer());
-  GrowableArray<G1HeapRegion*>* compaction_queue = collector()->serial_compaction_point()->regions();
-  for (GrowableArrayIterator<G1HeapRegion*> it = compaction_queue->begin();
-       it != compaction_queue->end();
-       ++it) {
-    compact_region(*it);
+bool G1FullGCCompactTask::CompactionQueue::is_claimed_completely() const {
+  return Atomic::load(&_next_position) >= _length;
+}
+
+bool G1FullGCCompactTask::CompactionQueue::destinations_compacted(uint position) const {
+  G1FullGCCompactionPoint::DestinationRange range = _cp->destination_range(position);
+  // Compacting within the region itself does not need to wait.
+  for (uint i = range._first; i <= range._last && i < position; i++) {
+    if (!Atomic::load_acquire(&_compacted[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool G1FullGCCompactTask::CompactionQueue::try_claim(uint& position) {
+  uint next = Atomic::load(&_next_position);
+  if (next >= _length || !destinations_compacted(next)) {
+    return false;
+  }
+  // All destinations lie at lower positions that have already been claimed, so
+  // they stay compacted once observed.
+  if (Atomic::cmpxchg(&_next_position, next, next + 1) != next) {
+    return false;
+  }
+  position = next;
+  return true;
+}
+
+void G1FullGCCompactTask::CompactionQueue::set_compacted(uint position) {
+  Atomic::release_store(&_compacted[position], true);
+}
+
+G1HeapRegion* G1FullGCCompactTask::CompactionQueue::region_at(uint position) const {
+  return _cp->regions()->at(position);
+}
+
+G1FullGCCompactTask::G1FullGCCompactTask(G1FullCollector* collector) :
+  G1FullGCTask("G1 Compact Task", collector),
+  _collector(collector),
+  _claimer(collector->workers()),
+  _g1h(G1CollectedHeap::heap()),
+  _queues(nullptr),
+  _num_queues(collector->workers()) {
+  _queues = new CompactionQueue[_num_queues];
+  for (uint i = 0; i < _num_queues; i++) {
+    _queues[i].initialize(collector->compaction_point(i));
+  }
+}
+
+G1FullGCCompactTask::G1FullGCCompactTask(G1FullCollector* collector, G1FullGCCompactionPoint* cp) :
+  G1FullGCTask("G1 Serial Compact Task", collector),
+  _collector(collector),
+  _claimer(collector->workers()),
+  _g1h(G1CollectedHeap::heap()),
+  _queues(nullptr),
+  _num_queues(1) {
+  _queues = new CompactionQueue[_num_queues];
+  _queues[0].initialize(cp);
+}
+
+G1FullGCCompactTask::~G1FullGCCompactTask() {
+  delete[] _queues;
+}
+
+bool G1FullGCCompactTask::compact_claimable_regions(uint start_queue) {
+  bool all_claimed = true;
+  for (uint i = 0; i < _num_queues; i++) {
+    CompactionQueue* queue = &_queues[(start_queue + i) % _num_queues];
+    uint position;
+    while (queue->try_claim(position)) {
+      compact_region(queue->region_at(position));
+      queue->set_compacted(position);
+    }
+    all_claimed &= queue->is_claimed_completely();
+  }
+  return all_claimed;
+}
+
+void G1FullGCCompactTask::work(uint worker_id) {
+  Ticks start = Ticks::now();
+  // Start with the own compaction queue, then help with the others. Regions that
+  // can not be compacted yet are left to later passes.
+  while (!compact_claimable_regions(worker_id % _num_queues)) {
+    SpinPause();
   }
+  log_task("Compaction task", worker_id, start);
 }
 
 void G1FullGCCompactTask::humongous_compaction() {
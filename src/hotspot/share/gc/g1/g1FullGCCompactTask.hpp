@@ -36,25 +36,55 @@ class G1CMBitMap;
 class G1FullCollector;
 
 class G1FullGCCompactTask : public G1FullGCTask {
+  // Shared state for compacting the regions of a compaction queue by any worker.
+  // Queue positions are claimed in order, and a region may only be compacted
+  // after all other regions its live objects are compacted into have been
+  // compacted, i.e. their live objects have been moved out of the way.
+  class CompactionQueue : public CHeapObj<mtGC> {
+    G1FullGCCompactionPoint* _cp;
+    uint _length;
+    volatile uint _next_position;
+    volatile bool* _compacted;
+
+    bool destinations_compacted(uint position) const;
+
+  public:
+    CompactionQueue() : _cp(nullptr), _length(0), _next_position(0), _compacted(nullptr) { }
+    ~CompactionQueue();
+
+    void initialize(G1FullGCCompactionPoint* cp);
+
+    bool is_claimed_completely() const;
+    // Claims the next position in the queue. Fails if all positions have been
+    // claimed or the region at the next position can not be compacted yet.
+    bool try_claim(uint& position);
+    void set_compacted(uint position);
+
+    G1HeapRegion* region_at(uint position) const;
+  };
+
   G1FullCollector* _collector;
   HeapRegionClaimer _claimer;
   G1CollectedHeap* _g1h;
+  CompactionQueue* _queues;
+  uint _num_queues;
 
   void compact_region(G1HeapRegion* hr);
+  // Returns whether all queues have been claimed completely.
+  bool compact_claimable_regions(uint start_queue);
   void compact_humongous_obj(G1HeapRegion* hr);
   void free_non_overlapping_regions(uint src_start_idx, uint dest_start_idx, uint num_regions);
 
   static void copy_object_to_new_location(oop obj);
 
 public:
-  G1FullGCCompactTask(G1FullCollector* collector) :
-    G1FullGCTask("G1 Compact Task", collector),
-    _collector(collector),
-    _claimer(collector->workers()),
-    _g1h(G1CollectedHeap::heap()) { }
+  // Compacts the compaction queues of all workers.
+  G1FullGCCompactTask(G1FullCollector* collector);
+  // Compacts the given single compaction queue.
+  G1FullGCCompactTask(G1FullCollector* collector, G1FullGCCompactionPoint* cp);
+  ~G1FullGCCompactTask();
 
   void work(uint worker_id);
-  void serial_compaction();
   void humongous_compaction();
 
   class G1CompactRegionClosure : public StackObj {
@@ -34,13 +34,16 @@ G1FullGCCompactionPoint::G1FullGCCompactionPoint(G1FullCollector* collector, Pre
     _collector(collector),
     _current_region(nullptr),
     _compaction_top(nullptr),
-    _preserved_stack(preserved_stack) {
+    _preserved_stack(preserved_stack),
+    _current_position(0) {
   _compaction_regions = new (mtGC) GrowableArray<G1HeapRegion*>(32, mtGC);
   _compaction_region_iterator = _compaction_regions->begin();
+  _destination_ranges = new (mtGC) GrowableArray<DestinationRange>(32, mtGC);
 }
 
 G1FullGCCompactionPoint::~G1FullGCCompactionPoint() {
   delete _compaction_regions;
+  delete _destination_ranges;
 }
 
 void G1FullGCCompactionPoint::update() {
@@ -73,9 +76,28 @@ G1HeapRegion* G1FullGCCompactionPoint::current_region() {
 G1HeapRegion* G1FullGCCompactionPoint::next_region() {
   G1HeapRegion* next = *(++_compaction_region_iterator);
   assert(next != nullptr, "Must return valid region");
+  _current_position++;
   return next;
 }
 
+void G1FullGCCompactionPoint::record_destination_range(uint first_position) {
+  assert(_destination_ranges->length() < _compaction_regions->length(),
+         "more destination ranges than regions");
+  assert(first_position <= _current_position, "destinations must not move backwards");
+  assert(_current_position <= (uint)_destination_ranges->length(),
+         "objects must not be compacted into later regions");
+  DestinationRange range = { first_position, _current_position };
+  _destination_ranges->append(range);
+}
+
+bool G1FullGCCompactionPoint::has_destination_ranges() const {
+  return _destination_ranges->length() == _compaction_regions->length();
+}
+
+G1FullGCCompactionPoint::DestinationRange G1FullGCCompactionPoint::destination_range(uint position) const {
+  return _destination_ranges->at(position);
+}
+
 GrowableArray<G1HeapRegion*>* G1FullGCCompactionPoint::regions() {
   return _compaction_regions;
 }
@@ -134,6 +156,7 @@ void G1FullGCCompactionPoint::remove_at_or_above(uint bottom) {
 
   assert(start_index >= 0, "Should have at least one region");
   _compaction_regions->trunc_to(start_index);
+  _destination_ranges->trunc_to(MIN2(start_index, _destination_ranges->length()));
 }
 
 void G1FullGCCompactionPoint::add_humongous(G1HeapRegion* hr) {
@@ -35,12 +35,24 @@ class G1HeapRegion;
 class PreservedMarks;
 
 class G1FullGCCompactionPoint : public CHeapObj<mtGC> {
+public:
+  // Queue positions of the first and last region the live objects of a region
+  // in the queue are compacted into.
+  struct DestinationRange {
+    uint _first;
+    uint _last;
+  };
+
+private:
   G1FullCollector* _collector;
   G1HeapRegion* _current_region;
   HeapWord* _compaction_top;
   PreservedMarks* _preserved_stack;
   GrowableArray<G1HeapRegion*>* _compaction_regions;
   GrowableArrayIterator<G1HeapRegion*> _compaction_region_iterator;
+  uint _current_position;
+  // Destination ranges for the regions of the queue, in queue order.
+  GrowableArray<DestinationRange>* _destination_ranges;
 
   bool object_will_fit(size_t size);
   void initialize_values();
@@ -63,6 +75,15 @@ class G1FullGCCompactionPoint : public CHeapObj<mtGC> {
 
   void remove_at_or_above(uint bottom);
   G1HeapRegion* current_region();
+  // Position of the current region in the queue.
+  uint current_position() const { return _current_position; }
+
+  // Records that the live objects of the next region in the queue without a
+  // recorded destination range are compacted into the regions between
+  // first_position and the current position.
+  void record_destination_range(uint first_position);
+  bool has_destination_ranges() const;
+  DestinationRange destination_range(uint position) const;
 
   GrowableArray<G1HeapRegion*>* regions();
 
@@ -81,7 +81,9 @@ void G1FullGCPrepareTask::work(uint worker_id) {
     for (GrowableArrayIterator<G1HeapRegion*> it = compaction_point->regions()->begin();
          it != compaction_point->regions()->end();
          ++it) {
+      uint first_destination = compaction_point->current_position();
       closure.do_heap_region(*it);
+      compaction_point->record_destination_range(first_destination);
     }
     compaction_point->update();
     // Determine if there are any unused compaction targets. This is only the case if
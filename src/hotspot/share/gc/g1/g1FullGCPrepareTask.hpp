@@ -103,13 +103,20 @@ class G1FullGCPrepareTask : public G1FullGCTask {
 class G1SerialRePrepareClosure : public StackObj {
   G1FullGCCompactionPoint* _cp;
   HeapWord* _dense_prefix_top;
+  // Whether objects have been skipped since the last reset, i.e. are compacted
+  // into the dense prefix.
+  bool _skipped_dense_prefix_objects;
 
 public:
   G1SerialRePrepareClosure(G1FullGCCompactionPoint* hrcp, HeapWord* dense_prefix_top) :
     _cp(hrcp),
-    _dense_prefix_top(dense_prefix_top) { }
+    _dense_prefix_top(dense_prefix_top),
+    _skipped_dense_prefix_objects(false) { }
 
   inline size_t apply(oop obj);
+
+  bool skipped_dense_prefix_objects() const { return _skipped_dense_prefix_objects; }
+  void reset_skipped_dense_prefix_objects() { _skipped_dense_prefix_objects = false; }
 };
 
 #endif // SHARE_GC_G1_G1FULLGCPREPARETASK_HPP
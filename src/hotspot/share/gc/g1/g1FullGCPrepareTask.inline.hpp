@@ -118,6 +118,7 @@ inline size_t G1SerialRePrepareClosure::apply(oop obj) {
     // We skip objects compiled into the first region or
     // into regions not part of the serial compaction point.
     if (cast_from_oop<HeapWord*>(obj->forwardee()) < _dense_prefix_top) {
+      _skipped_dense_prefix_objects = true;
       return obj->size();
     }
   }
@@ -633,6 +633,46 @@ uint HeapRegionManager::shrink_by(uint num_regions_to_remove) {
   return removed;
 }
 
+uint HeapRegionManager::shrink_free_regions_by(uint num_regions_to_remove) {
+  assert_heap_locked_and_not_at_safepoint();
+  assert(num_regions_to_remove < length(), "We should never remove all regions");
+
+  uint removed = 0;
+  uint cur = _allocated_heapregions_length;
+
+  auto is_available_and_free = [&] (uint index) {
+    return is_available(index) && at(index)->is_free();
+  };
+
+  while (removed < num_regions_to_remove && cur > 0) {
+    cur--;
+    if (!is_available_and_free(cur)) {
+      continue;
+    }
+    // Find the start of this range of free regions, limited to the number of
+    // regions still to remove.
+    uint end = cur + 1;
+    while (cur > 0 &&
+           (end - cur) < (num_regions_to_remove - removed) &&
+           is_available_and_free(cur - 1)) {
+      cur--;
+    }
+    uint to_remove = end - cur;
+
+    // The free list is sorted, so the regions are consecutive in it too.
+    _free_list.remove_starting_at(at(cur), to_remove);
+    {
+      MutexLocker uc(Uncommit_lock, Mutex::_no_safepoint_check_flag);
+      shrink_at(cur, to_remove);
+    }
+    removed += to_remove;
+  }
+
+  verify_optional();
+
+  return removed;
+}
+
 void HeapRegionManager::shrink_at(uint index, size_t num_regions) {
 #ifdef ASSERT
   for (uint i = index; i < (index + num_regions); i++) {
@@ -277,6 +277,11 @@ class HeapRegionManager: public CHeapObj<mtGC> {
   // Return the actual number of uncommitted regions.
   uint shrink_by(uint num_regions_to_remove);
 
+  // Uncommit up to num_regions_to_remove regions from the free list outside of a
+  // safepoint, starting with the highest addresses. Must be called with the
+  // Heap_lock held. Return the actual number of uncommitted regions.
+  uint shrink_free_regions_by(uint num_regions_to_remove);
+
   // Remove a number of regions starting at the specified index, which must be available,
   // empty, and free. The regions are marked inactive and can later be uncommitted.
   void shrink_at(uint index, size_t num_regions);
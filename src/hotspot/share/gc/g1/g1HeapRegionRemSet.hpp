@@ -81,6 +81,10 @@ class HeapRegionRemSet : public CHeapObj<mtGC> {
     return _card_set.occupied();
   }
 
+  void iterate_container_fingerprints(G1CardSet::ContainerFingerprintClosure* cl, bool at_safepoint) {
+    _card_set.iterate_container_fingerprints(cl, at_safepoint);
+  }
+
   static void initialize(MemRegion reserved);
 
   // Coarsening statistics since VM start.
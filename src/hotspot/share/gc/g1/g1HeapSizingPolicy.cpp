@@ -26,6 +26,7 @@
 #include "gc/g1/g1Analytics.hpp"
 #include "gc/g1/g1CollectedHeap.hpp"
 #include "gc/g1/g1HeapSizingPolicy.hpp"
+#include "gc/g1/g1Policy.hpp"
 #include "gc/shared/gc_globals.hpp"
 #include "logging/log.hpp"
 #include "runtime/globals.hpp"
@@ -213,6 +214,34 @@ static size_t target_heap_capacity(size_t used_bytes, uintx free_ratio) {
   return (size_t) desired_capacity_d;
 }
 
+uint G1HeapSizingPolicy::memory_pressure_shrink_regions() const {
+  const G1Policy* policy = _g1h->policy();
+
+  // The young generation target length is sized according to the allocation
+  // rate and the pause time goal; the mutator will allocate that many regions
+  // before the next young collection anyway.
+  const uint young_target = policy->young_list_target_length();
+  const uint young = _g1h->young_regions_count();
+  const uint expected_allocation = young_target - MIN2(young_target, young);
+  const uint retained = expected_allocation + policy->reserve_regions();
+
+  const uint free = _g1h->num_free_regions();
+  if (free <= retained) {
+    return 0;
+  }
+
+  const uint min_regions = MAX2(1u, (uint)(MinHeapSize / G1HeapRegion::GrainBytes));
+  const uint num_regions = _g1h->num_regions();
+  if (num_regions <= min_regions) {
+    return 0;
+  }
+
+  // Give back half of the excess free regions at a time so that the heap
+  // shrinks gradually while the memory pressure persists.
+  const uint excess = free - retained;
+  return MIN2(num_regions - min_regions, (excess + 1) / 2);
+}
+
 size_t G1HeapSizingPolicy::full_collection_resize_amount(bool& expand) {
   // Capacity, free and used after the GC counted as full regions to
   // include the waste in the following calculations.
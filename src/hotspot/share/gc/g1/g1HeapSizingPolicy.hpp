@@ -62,6 +62,11 @@ class G1HeapSizingPolicy: public CHeapObj<mtGC> {
   // Clear ratio tracking data used by expansion_amount().
   void clear_ratio_check_data();
 
+  // Returns the number of free regions to uncommit when the system is under
+  // memory pressure. Keeps the free regions the mutator is expected to
+  // allocate into before the next young collection as well as the reserve.
+  uint memory_pressure_shrink_regions() const;
+
   static G1HeapSizingPolicy* create(const G1CollectedHeap* g1h, const G1Analytics* analytics);
 };
 
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1MemoryPressureUncommitTask.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
+#include "logging/log.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "utilities/macros.hpp"
+#ifdef LINUX
+#include "osContainer_linux.hpp"
+#endif
+
+G1MemoryPressureUncommitTask::G1MemoryPressureUncommitTask(const char* name) :
+  G1ServiceTask(name),
+  _under_pressure(false) { }
+
+double G1MemoryPressureUncommitTask::current_memory_pressure() {
+#ifdef LINUX
+  if (OSContainer::is_containerized()) {
+    return OSContainer::memory_pressure();
+  }
+#endif
+  return -1.0;
+}
+
+bool G1MemoryPressureUncommitTask::update_under_pressure(double pressure) {
+  if (!_under_pressure && pressure >= G1MemoryPressureUncommitThreshold) {
+    log_debug(gc, heap)("Memory pressure %1.2f%% reached threshold %1.2f%%. Start uncommitting.",
+                        pressure, G1MemoryPressureUncommitThreshold);
+    _under_pressure = true;
+  } else if (_under_pressure && pressure < G1MemoryPressureUncommitThreshold / 2.0) {
+    log_debug(gc, heap)("Memory pressure %1.2f%% dropped below %1.2f%%. Stop uncommitting.",
+                        pressure, G1MemoryPressureUncommitThreshold / 2.0);
+    _under_pressure = false;
+  }
+  return _under_pressure;
+}
+
+void G1MemoryPressureUncommitTask::try_shrink_heap() {
+  // Ensure no GC safepoints while changing the heap size.
+  SuspendibleThreadSetJoiner sts;
+
+  // Getting the Heap_lock by blocking while joined to the suspendible thread set
+  // could deadlock with a GC VM operation that holds the lock and requests a
+  // safepoint. Skip this check instead and retry next time.
+  if (!Heap_lock->try_lock()) {
+    log_debug(gc, heap)("Heap lock not available. Skipping.");
+    return;
+  }
+  G1CollectedHeap::heap()->shrink_for_memory_pressure();
+  Heap_lock->unlock();
+}
+
+void G1MemoryPressureUncommitTask::execute() {
+  double pressure = current_memory_pressure();
+  if (pressure < 0.0) {
+    // Do not reschedule; the memory pressure will never be available.
+    log_info(gc, heap)("Memory pressure not available. Disabling memory pressure based uncommit.");
+    return;
+  }
+
+  log_trace(gc, heap)("Memory pressure %1.2f%%", pressure);
+  if (update_under_pressure(pressure)) {
+    try_shrink_heap();
+  }
+  schedule(G1MemoryPressureUncommitInterval);
+}
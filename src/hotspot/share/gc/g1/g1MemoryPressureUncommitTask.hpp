@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1MEMORYPRESSUREUNCOMMITTASK_HPP
+#define SHARE_GC_G1_G1MEMORYPRESSUREUNCOMMITTASK_HPP
+
+#include "gc/g1/g1ServiceThread.hpp"
+
+// Task periodically checking the container memory pressure. While the memory
+// pressure is high, free regions not needed until the next collection are
+// uncommitted without a safepoint.
+//
+// Uncommitting starts when the pressure reaches G1MemoryPressureUncommitThreshold
+// and stops after it dropped below half of that value again.
+class G1MemoryPressureUncommitTask : public G1ServiceTask {
+  bool _under_pressure;
+
+  // Returns the current memory pressure in percent, or a negative value if
+  // not available.
+  static double current_memory_pressure();
+
+  bool update_under_pressure(double pressure);
+  void try_shrink_heap();
+
+public:
+  G1MemoryPressureUncommitTask(const char* name);
+  virtual void execute();
+};
+
+#endif // SHARE_GC_G1_G1MEMORYPRESSUREUNCOMMITTASK_HPP
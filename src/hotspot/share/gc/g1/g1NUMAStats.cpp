@@ -157,6 +157,8 @@ static const char* phase_to_explanatory_string(G1NUMAStats::NodeDataItems phase)
       return "Placement match ratio";
     case G1NUMAStats::LocalObjProcessAtCopyToSurv:
       return "Worker task locality match ratio";
+    case G1NUMAStats::LocalObjPromotion:
+      return "Promotion locality match ratio";
     default:
       return "";
   }
@@ -227,4 +229,5 @@ void G1NUMAStats::print_statistics() {
   print_mutator_alloc_stat_debug();
 
   print_info(LocalObjProcessAtCopyToSurv);
+  print_info(LocalObjPromotion);
 }
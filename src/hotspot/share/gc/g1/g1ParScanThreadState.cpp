@@ -86,6 +86,7 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _max_num_optional_regions(collection_set->optional_region_length()),
     _numa(g1h->numa()),
     _obj_alloc_stat(nullptr),
+    _obj_promotion_stat(nullptr),
     ALLOCATION_FAILURE_INJECTOR_ONLY(_allocation_failure_inject_counter(0) COMMA)
     _preserved_marks(preserved_marks),
     _evacuation_failed_info(),
@@ -139,6 +140,7 @@ G1ParScanThreadState::~G1ParScanThreadState() {
   FREE_C_HEAP_ARRAY(size_t, _surviving_young_words_base);
   delete[] _oops_into_optional_regions;
   FREE_C_HEAP_ARRAY(size_t, _obj_alloc_stat);
+  FREE_C_HEAP_ARRAY(size_t, _obj_promotion_stat);
 }
 
 size_t G1ParScanThreadState::lab_waste_words() const {
@@ -496,6 +498,10 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
     return handle_evacuation_failure_par(old, old_mark, word_sz, false /* cause_pinned */);
   }
 
+  if (dest_attr.is_old()) {
+    update_numa_promotion_stats(node_index, obj_ptr);
+  }
+
   // We're going to allocate linearly, so might as well prefetch ahead.
   Prefetch::write(obj_ptr, PrefetchCopyIntervalInBytes);
   Copy::aligned_disjoint_words(cast_from_oop<HeapWord*>(old), obj_ptr, word_sz);
@@ -685,6 +691,8 @@ void G1ParScanThreadState::initialize_numa_stats() {
       // Record only if there are multiple active nodes.
       _obj_alloc_stat = NEW_C_HEAP_ARRAY(size_t, num_nodes, mtGC);
       memset(_obj_alloc_stat, 0, sizeof(size_t) * num_nodes);
+      _obj_promotion_stat = NEW_C_HEAP_ARRAY(size_t, num_nodes * num_nodes, mtGC);
+      memset(_obj_promotion_stat, 0, sizeof(size_t) * num_nodes * num_nodes);
     }
   }
 }
@@ -694,6 +702,14 @@ void G1ParScanThreadState::flush_numa_stats() {
     uint node_index = _numa->index_of_current_thread();
     _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToSurv, node_index, _obj_alloc_stat);
   }
+  if (_obj_promotion_stat != nullptr) {
+    uint num_nodes = _numa->num_active_nodes();
+    for (uint from_node_index = 0; from_node_index < num_nodes; from_node_index++) {
+      _numa->copy_statistics(G1NUMAStats::LocalObjPromotion,
+                             from_node_index,
+                             _obj_promotion_stat + from_node_index * num_nodes);
+    }
+  }
 }
 
 void G1ParScanThreadState::update_numa_stats(uint node_index) {
@@ -702,6 +718,16 @@ void G1ParScanThreadState::update_numa_stats(uint node_index) {
   }
 }
 
+void G1ParScanThreadState::update_numa_promotion_stats(uint from_node_index, HeapWord* obj_ptr) {
+  if (_obj_promotion_stat != nullptr) {
+    uint num_nodes = _numa->num_active_nodes();
+    uint to_node_index = _g1h->heap_region_containing(obj_ptr)->node_index();
+    if (from_node_index < num_nodes && to_node_index < num_nodes) {
+      _obj_promotion_stat[from_node_index * num_nodes + to_node_index]++;
+    }
+  }
+}
+
 G1ParScanThreadStateSet::G1ParScanThreadStateSet(G1CollectedHeap* g1h,
                                                  uint num_workers,
                                                  G1CollectionSet* collection_set,
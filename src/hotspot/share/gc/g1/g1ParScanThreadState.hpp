@@ -102,6 +102,10 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   // Only starts recording when log of gc+heap+numa is enabled and its data is
   // transferred when flushed.
   size_t* _obj_alloc_stat;
+  // Records how many objects from each source node have been promoted into old
+  // regions on each node, as a (source node) * (destination node) matrix. Only
+  // starts recording when log of gc+heap+numa is enabled.
+  size_t* _obj_promotion_stat;
 
   // Per-thread evacuation failure data structures.
   ALLOCATION_FAILURE_INJECTOR_ONLY(size_t _allocation_failure_inject_counter;)
@@ -219,6 +223,7 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   void initialize_numa_stats();
   void flush_numa_stats();
   inline void update_numa_stats(uint node_index);
+  void update_numa_promotion_stats(uint from_node_index, HeapWord* obj_ptr);
 
 public:
   oop copy_to_survivor_space(G1HeapRegionAttr region_attr, oop obj, markWord old_mark);
@@ -70,8 +70,11 @@ G1Policy::G1Policy(STWGCTimer* gc_timer) :
   _young_gen_sizer(),
   _free_regions_at_end_of_collection(0),
   _card_rs_length(0),
+  _eden_copied_bytes(0),
+  _survivor_copied_bytes(0),
   _pending_cards_at_gc_start(0),
   _concurrent_start_to_mixed(),
+  _young_worker_efficiency(),
   _collection_set(nullptr),
   _g1h(nullptr),
   _phase_times_timer(gc_timer),
@@ -607,12 +610,14 @@ void G1Policy::record_full_collection_end() {
 static void log_refinement_stats(const char* kind, const G1ConcurrentRefineStats& stats) {
   log_debug(gc, refine, stats)
            ("%s refinement: %.2fms, refined: " SIZE_FORMAT
-            ", precleaned: " SIZE_FORMAT ", dirtied: " SIZE_FORMAT,
+            ", precleaned: " SIZE_FORMAT ", dirtied: " SIZE_FORMAT
+            ", swept: " SIZE_FORMAT,
             kind,
             stats.refinement_time().seconds() * MILLIUNITS,
             stats.refined_cards(),
             stats.precleaned_cards(),
-            stats.dirtied_cards());
+            stats.dirtied_cards(),
+            stats.swept_cards());
 }
 
 void G1Policy::record_concurrent_refinement_stats(size_t pending_cards,
@@ -920,8 +925,14 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
     size_t copied_bytes = p->sum_thread_work_items(G1GCPhaseTimes::MergePSS, G1GCPhaseTimes::MergePSSCopiedBytes);
 
     if (copied_bytes > 0) {
-      double cost_per_byte_ms = (average_time_ms(G1GCPhaseTimes::ObjCopy) + average_time_ms(G1GCPhaseTimes::OptObjCopy)) / copied_bytes;
+      double copy_time_ms = average_time_ms(G1GCPhaseTimes::ObjCopy) + average_time_ms(G1GCPhaseTimes::OptObjCopy);
+      double cost_per_byte_ms = copy_time_ms / copied_bytes;
       _analytics->report_cost_per_byte_ms(cost_per_byte_ms, is_young_only_pause);
+
+      // Only sample the per-cohort copy cost if all copied bytes come from the young gen.
+      if (is_young_only_pause && _collection_set->initial_old_region_length() == 0) {
+        _analytics->report_young_cohort_copy_time_ms(_eden_copied_bytes, _survivor_copied_bytes, copy_time_ms);
+      }
     }
 
     if (_collection_set->young_region_length() > 0) {
@@ -1115,11 +1126,17 @@ double G1Policy::predict_eden_copy_time_ms(uint count, size_t* bytes_to_copy) co
   if (bytes_to_copy != nullptr) {
     *bytes_to_copy = expected_bytes;
   }
-  return _analytics->predict_object_copy_time_ms(expected_bytes, collector_state()->in_young_only_phase());
+  return _analytics->predict_object_copy_time_ms(expected_bytes,
+                                                 collector_state()->in_young_only_phase(),
+                                                 G1CopyCostModel::Eden);
 }
 
 double G1Policy::predict_region_copy_time_ms(G1HeapRegion* hr, bool for_young_only_phase) const {
   size_t const bytes_to_copy = predict_bytes_to_copy(hr);
+  if (hr->is_young()) {
+    G1CopyCostModel::Cohort cohort = hr->is_eden() ? G1CopyCostModel::Eden : G1CopyCostModel::Survivor;
+    return _analytics->predict_object_copy_time_ms(bytes_to_copy, for_young_only_phase, cohort);
+  }
   return _analytics->predict_object_copy_time_ms(bytes_to_copy, for_young_only_phase);
 }
 
@@ -35,6 +35,7 @@
 #include "gc/g1/g1Predictions.hpp"
 #include "gc/g1/g1YoungGenSizer.hpp"
 #include "gc/shared/gcCause.hpp"
+#include "gc/shared/gcWorkerEfficiency.hpp"
 #include "runtime/atomic.hpp"
 #include "utilities/pair.hpp"
 #include "utilities/ticks.hpp"
@@ -105,10 +106,17 @@ class G1Policy: public CHeapObj<mtGC> {
 
   size_t _card_rs_length;
 
+  // Bytes copied from eden and survivor regions respectively in the current GC.
+  size_t _eden_copied_bytes;
+  size_t _survivor_copied_bytes;
+
   size_t _pending_cards_at_gc_start;
 
   G1ConcurrentStartToMixedTimeTracker _concurrent_start_to_mixed;
 
+  // CPU efficiency of the workers in young collections.
+  GCWorkerEfficiency _young_worker_efficiency;
+
   bool should_update_surv_rate_group_predictors() {
     return collector_state()->in_young_only_phase() && !collector_state()->mark_or_rebuild_in_progress();
   }
@@ -120,6 +128,8 @@ class G1Policy: public CHeapObj<mtGC> {
 
   G1RemSetTrackingPolicy* remset_tracker() { return &_remset_tracker; }
 
+  GCWorkerEfficiency* young_worker_efficiency() { return &_young_worker_efficiency; }
+
   G1OldGenAllocationTracker* old_gen_alloc_tracker() { return &_old_gen_alloc_tracker; }
 
   void set_region_eden(G1HeapRegion* hr) {
@@ -136,6 +146,11 @@ class G1Policy: public CHeapObj<mtGC> {
     _card_rs_length = card_rs_length;
   }
 
+  void record_young_cohort_copied_bytes(size_t eden_bytes, size_t survivor_bytes) {
+    _eden_copied_bytes = eden_bytes;
+    _survivor_copied_bytes = survivor_bytes;
+  }
+
   double predict_base_time_ms(size_t pending_cards) const;
 
 private:
@@ -384,6 +399,9 @@ class G1Policy: public CHeapObj<mtGC> {
   uint young_list_desired_length() const { return Atomic::load(&_young_list_desired_length); }
   uint young_list_target_length() const { return Atomic::load(&_young_list_target_length); }
 
+  // Number of free regions kept as reserve for evacuation.
+  uint reserve_regions() const { return _reserve_regions; }
+
   bool should_allocate_mutator_region() const;
 
   bool use_adaptive_young_list_length() const;
@@ -1258,6 +1258,38 @@ class G1MergeHeapRootsTask : public WorkerTask {
     size_t cards_skipped() const { return _cards_skipped; }
   };
 
+  // Visitor for the card table to merge the cards dirtied by the mutators when
+  // using G1UseCardTableRefinement, as they are not in the log buffers.
+  class G1MergeCardTableClosure : public StackObj {
+    G1RemSetScanState* _scan_state;
+    G1CardTable* _ct;
+
+    size_t _cards_dirty;
+
+  public:
+    G1MergeCardTableClosure(G1CollectedHeap* g1h, G1RemSetScanState* scan_state) :
+      _scan_state(scan_state),
+      _ct(g1h->card_table()),
+      _cards_dirty(0)
+    {}
+
+    void merge_region(G1HeapRegion* r) {
+      G1CardTable::CardValue* const end = _ct->byte_for(r->end() - 1) + 1;
+      G1CardTable::CardValue* cur = _ct->find_first_dirty_card(_ct->byte_for(r->bottom()), end);
+      if (cur == end) {
+        return;
+      }
+      _scan_state->add_dirty_region(r->hrm_index());
+      do {
+        _scan_state->set_chunk_dirty(_ct->index_for_cardvalue(cur));
+        _cards_dirty++;
+        cur = _ct->find_first_dirty_card(cur + 1, end);
+      } while (cur < end);
+    }
+
+    size_t cards_dirty() const { return _cards_dirty; }
+  };
+
   uint _num_workers;
   G1RemSetScanState* _scan_state;
 
@@ -1273,6 +1305,23 @@ class G1MergeHeapRootsTask : public WorkerTask {
 
   volatile bool _fast_reclaim_handled;
 
+  // Next region to merge from the card table when using G1UseCardTableRefinement.
+  volatile uint _card_table_merge_claim;
+
+  void merge_card_table(G1MergeCardTableClosure* cl) {
+    G1CollectedHeap* g1h = G1CollectedHeap::heap();
+    uint const max_regions = g1h->max_reserved_regions();
+    while (true) {
+      uint region_idx = Atomic::fetch_then_add(&_card_table_merge_claim, 1u);
+      if (region_idx >= max_regions) {
+        break;
+      }
+      if (_scan_state->contains_cards_to_process(region_idx)) {
+        cl->merge_region(g1h->region_at(region_idx));
+      }
+    }
+  }
+
   void apply_closure_to_dirty_card_buffers(G1MergeLogBufferCardsClosure* cl, uint worker_id) {
     G1DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
     for (uint i = 0; i < _num_workers; i++) {
@@ -1291,7 +1340,8 @@ class G1MergeHeapRootsTask : public WorkerTask {
     _scan_state(scan_state),
     _dirty_card_buffers(nullptr),
     _initial_evacuation(initial_evacuation),
-    _fast_reclaim_handled(false)
+    _fast_reclaim_handled(false),
+    _card_table_merge_claim(0)
   {
     if (initial_evacuation) {
       Ticks start = Ticks::now();
@@ -1396,7 +1446,14 @@ class G1MergeHeapRootsTask : public WorkerTask {
       G1MergeLogBufferCardsClosure cl(g1h, _scan_state);
       apply_closure_to_dirty_card_buffers(&cl, worker_id);
 
-      p->record_thread_work_item(G1GCPhaseTimes::MergeLB, worker_id, cl.cards_dirty(), G1GCPhaseTimes::MergeLBDirtyCards);
+      size_t cards_dirty = cl.cards_dirty();
+      if (G1UseCardTableRefinement) {
+        G1MergeCardTableClosure ct_cl(g1h, _scan_state);
+        merge_card_table(&ct_cl);
+        cards_dirty += ct_cl.cards_dirty();
+      }
+
+      p->record_thread_work_item(G1GCPhaseTimes::MergeLB, worker_id, cards_dirty, G1GCPhaseTimes::MergeLBDirtyCards);
       p->record_thread_work_item(G1GCPhaseTimes::MergeLB, worker_id, cl.cards_skipped(), G1GCPhaseTimes::MergeLBSkippedCards);
     }
   }
@@ -35,7 +35,10 @@
 #include "gc/g1/g1RemSetSummary.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/iterator.hpp"
+#include "memory/resourceArea.hpp"
 #include "runtime/javaThread.hpp"
+#include "runtime/safepoint.hpp"
+#include "utilities/resizeableResourceHash.hpp"
 
 void G1RemSetSummary::update() {
   class CollectData : public ThreadClosure {
@@ -181,6 +184,67 @@ class RegionTypeCounter {
 };
 
 
+// Groups card set containers with identical contents across all remembered
+// sets, estimating how much memory sharing them would save.
+class G1IdenticalContainersCounter : public G1CardSet::ContainerFingerprintClosure {
+  struct Key {
+    uint _card_region_idx;
+    uint _container_type;
+    size_t _num_occupied;
+    uint64_t _hash;
+
+    static unsigned hash(const Key& k) {
+      return (unsigned)(k._hash ^ (k._hash >> 32)) ^ k._card_region_idx;
+    }
+
+    static bool equals(const Key& a, const Key& b) {
+      return a._hash == b._hash &&
+             a._card_region_idx == b._card_region_idx &&
+             a._container_type == b._container_type &&
+             a._num_occupied == b._num_occupied;
+    }
+  };
+
+  ResizeableResourceHashtable<Key, uint, AnyObj::RESOURCE_AREA, mtGC, Key::hash, Key::equals> _table;
+
+  size_t _num_containers;
+  size_t _num_duplicates;
+  size_t _num_groups;
+  size_t _savings;
+
+public:
+  G1IdenticalContainersCounter() :
+    _table(1024, 1024 * 1024),
+    _num_containers(0), _num_duplicates(0), _num_groups(0), _savings(0) { }
+
+  void do_fingerprint(uint card_region_idx,
+                      uint container_type,
+                      size_t num_occupied,
+                      uint64_t hash,
+                      size_t container_mem_size) override {
+    Key key = { card_region_idx, container_type, num_occupied, hash };
+    bool created;
+    uint* count = _table.put_if_absent(key, 0, &created);
+    _num_containers++;
+    if (!created) {
+      if (*count == 1) {
+        _num_groups++;
+      }
+      _num_duplicates++;
+      _savings += container_mem_size;
+    }
+    (*count)++;
+    _table.maybe_grow();
+  }
+
+  void print_on(outputStream* out) const {
+    out->print_cr("  Identical card set containers = " SIZE_FORMAT " of " SIZE_FORMAT
+                  " in " SIZE_FORMAT " groups, potential sharing savings = " SIZE_FORMAT "%s",
+                  _num_duplicates, _num_containers, _num_groups,
+                  byte_size_in_proper_unit(_savings), proper_unit_for_byte_size(_savings));
+  }
+};
+
 class HRRSStatsIter: public HeapRegionClosure {
 private:
   RegionTypeCounter _young;
@@ -208,11 +272,15 @@ class HRRSStatsIter: public HeapRegionClosure {
   size_t max_code_root_mem_sz() const       { return _max_code_root_mem_sz; }
   G1HeapRegion* max_code_root_mem_sz_region() const { return _max_code_root_mem_sz_region; }
 
+  G1IdenticalContainersCounter _identical_containers;
+  bool _at_safepoint;
+
 public:
   HRRSStatsIter() : _young("Young"), _humongous("Humongous"),
     _free("Free"), _old("Old"), _all("All"),
     _max_rs_mem_sz(0), _max_rs_mem_sz_region(nullptr),
-    _max_code_root_mem_sz(0), _max_code_root_mem_sz_region(nullptr)
+    _max_code_root_mem_sz(0), _max_code_root_mem_sz_region(nullptr),
+    _identical_containers(), _at_safepoint(SafepointSynchronize::is_at_safepoint())
   {}
 
   bool do_heap_region(G1HeapRegion* r) {
@@ -234,6 +302,8 @@ class HRRSStatsIter: public HeapRegionClosure {
     }
     size_t code_root_elems = hrrs->code_roots_list_length();
 
+    hrrs->iterate_container_fingerprints(&_identical_containers, _at_safepoint);
+
     RegionTypeCounter* current = nullptr;
     if (r->is_free()) {
       current = &_free;
@@ -281,6 +351,8 @@ class HRRSStatsIter: public HeapRegionClosure {
                   rem_set->mem_size(),
                   rem_set->occupied());
 
+    _identical_containers.print_on(out);
+
     HeapRegionRemSet::print_static_mem_size(out);
     G1CollectedHeap* g1h = G1CollectedHeap::heap();
     g1h->card_set_freelist_pool()->print_on(out);
@@ -322,6 +394,7 @@ void G1RemSetSummary::print_on(outputStream* out, bool show_thread_times) {
     out->cr();
   }
 
+  ResourceMark rm;
   HRRSStatsIter blk;
   G1CollectedHeap::heap()->heap_region_iterate(&blk);
   blk.print_summary_on(out);
@@ -27,6 +27,7 @@
 #include "gc/g1/g1UncommitRegionTask.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/safepoint.hpp"
 #include "utilities/ticks.hpp"
 
 G1UncommitRegionTask* G1UncommitRegionTask::_instance = nullptr;
@@ -55,7 +56,10 @@ G1UncommitRegionTask* G1UncommitRegionTask::instance() {
 }
 
 void G1UncommitRegionTask::enqueue() {
-  assert_at_safepoint_on_vm_thread();
+  assert(SafepointSynchronize::is_at_safepoint() ?
+         Thread::current()->is_VM_thread() :
+         Thread::current() == G1CollectedHeap::heap()->service_thread(),
+         "must be at a safepoint on the VM thread or on the service thread");
 
   G1UncommitRegionTask* uncommit_task = instance();
   if (!uncommit_task->is_active()) {
@@ -72,9 +76,9 @@ bool G1UncommitRegionTask::is_active() {
 void G1UncommitRegionTask::set_active(bool state) {
   assert(_active != state, "Must do a state change");
   // There is no need to guard _active with a lock since the places where it
-  // is updated can never run in parallel. The state is set to true only in
-  // a safepoint and it is set to false while running on the service thread
-  // joined with the suspendible thread set.
+  // is updated can never run in parallel. The state is set to true in a
+  // safepoint or on the service thread, and it is set to false while running
+  // on the service thread joined with the suspendible thread set.
   _active = state;
 }
 
@@ -32,7 +32,7 @@
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1CollectionSetCandidates.inline.hpp"
 #include "gc/g1/g1CollectorState.hpp"
-#include "gc/g1/g1ConcurrentMark.hpp"
+#include "gc/g1/g1ConcurrentMark.inline.hpp"
 #include "gc/g1/g1GCPhaseTimes.hpp"
 #include "gc/g1/g1EvacFailureRegions.inline.hpp"
 #include "gc/g1/g1EvacInfo.hpp"
@@ -344,12 +344,16 @@ class G1PrepareEvacuationTask : public WorkerTask {
       // structures don't support efficiently performing the needed
       // additional tests or scrubbing of the mark stack.
       //
-      // However, we presently only nominate is_typeArray() objects.
-      // A humongous object containing references induces remembered
-      // set entries on other regions.  In order to reclaim such an
-      // object, those remembered sets would need to be cleaned up.
+      // A humongous object array induces remembered set entries on
+      // other regions.  These entries become stale when the object is
+      // reclaimed, which is benign: scanning a stale card just visits
+      // whatever objects occupy the card later, as when an old region is
+      // evacuated.  Object arrays allocated before the start of marking
+      // may be on the mark stack (whole or as array slices), so these are
+      // only nominated when marking is not in progress or they have been
+      // allocated since its start.
       //
-      // We also treat is_typeArray() objects specially, allowing them
+      // We treat is_typeArray() objects specially, allowing them
       // to be reclaimed even if allocated before the start of
       // concurrent mark.  For this we rely on mark stack insertion to
       // exclude is_typeArray() objects, preventing reclaiming an object
@@ -359,8 +363,15 @@ class G1PrepareEvacuationTask : public WorkerTask {
       // important use case for eager reclaim, and this special handling
       // may reduce needed headroom.
 
-      return obj->is_typeArray() &&
-             _g1h->is_potential_eager_reclaim_candidate(region);
+      if (!G1CollectedHeap::is_eager_reclaim_kind(obj)) {
+        return false;
+      }
+      if (!obj->is_typeArray() &&
+          _g1h->collector_state()->mark_or_rebuild_in_progress() &&
+          !_g1h->concurrent_mark()->obj_allocated_since_mark_start(obj)) {
+        return false;
+      }
+      return _g1h->is_potential_eager_reclaim_candidate(region);
     }
 
   public:
@@ -396,7 +407,7 @@ class G1PrepareEvacuationTask : public WorkerTask {
         _g1h->register_region_with_region_attr(hr);
       }
       log_debug(gc, humongous)("Humongous region %u (object size %zu @ " PTR_FORMAT ") remset %zu code roots %zu "
-                               "marked %d pinned count %zu reclaim candidate %d type array %d",
+                               "marked %d pinned count %zu reclaim candidate %d type array %d obj array %d",
                                index,
                                cast_to_oop(hr->bottom())->size() * HeapWordSize,
                                p2i(hr->bottom()),
@@ -405,7 +416,8 @@ class G1PrepareEvacuationTask : public WorkerTask {
                                _g1h->concurrent_mark()->mark_bitmap()->is_marked(hr->bottom()),
                                hr->pinned_count(),
                                _g1h->is_humongous_reclaim_candidate(index),
-                               cast_to_oop(hr->bottom())->is_typeArray()
+                               cast_to_oop(hr->bottom())->is_typeArray(),
+                               cast_to_oop(hr->bottom())->is_objArray()
                               );
       _worker_humongous_total++;
 
@@ -471,6 +483,7 @@ void G1YoungCollector::set_young_collection_default_active_worker_threads(){
   uint active_workers = WorkerPolicy::calc_active_workers(workers()->max_workers(),
                                                           workers()->active_workers(),
                                                           Threads::number_of_non_daemon_threads());
+  active_workers = policy()->young_worker_efficiency()->limit_active_workers(active_workers);
   active_workers = workers()->set_active_workers(active_workers);
   log_info(gc,task)("Using %u workers of %u for evacuation", active_workers, workers()->max_workers());
 }
@@ -1076,6 +1089,7 @@ void G1YoungCollector::collect() {
     // policy for the collection deliberately elides verification (and some
     // other trivial setup above).
     policy()->record_young_collection_start();
+    GCWorkerEfficiencyMark wem(policy()->young_worker_efficiency(), workers());
 
     pre_evacuate_collection_set(jtm.evacuation_info());
 
@@ -192,8 +192,10 @@ class G1PostEvacuateCollectionSetCleanupTask1::RestoreEvacFailureRegionsTask : p
     }
   }
 
+  // Prefetch the header of the given object, which is read to get the size and
+  // written to restore the mark.
   static void prefetch_obj(HeapWord* obj_addr) {
-    Prefetch::write(obj_addr, PrefetchScanIntervalInBytes);
+    Prefetch::write(obj_addr, 0);
   }
 
   bool claim_chunk(uint chunk_idx) {
@@ -217,13 +219,20 @@ class G1PostEvacuateCollectionSetCleanupTask1::RestoreEvacFailureRegionsTask : p
     }
 
     HeapWord* chunk_end = MIN2(chunk_start + _chunk_size, hr_top);
-    HeapWord* first_marked_addr = bitmap->get_next_marked_addr(chunk_start, hr_top);
+    HeapWord* first_marked_addr;
 
     size_t garbage_words = 0;
 
     if (chunk_start == hr_bottom) {
       // This is the bottom-most chunk in this region; zap [bottom, first_marked_addr).
+      first_marked_addr = bitmap->get_next_marked_addr(chunk_start, hr_top);
       garbage_words += zap_dead_objects(hr, hr_bottom, first_marked_addr);
+    } else {
+      // Dead ranges starting in this chunk before the first marked object are
+      // zapped by the chunk containing the preceding marked object, so only look
+      // within this chunk. Otherwise every empty chunk of a sparsely failed region
+      // would search the bitmap up to the next marked object.
+      first_marked_addr = bitmap->get_next_marked_addr(chunk_start, chunk_end);
     }
 
     if (first_marked_addr >= chunk_end) {
@@ -241,9 +250,19 @@ class G1PostEvacuateCollectionSetCleanupTask1::RestoreEvacFailureRegionsTask : p
     assert(chunk_start <= obj_addr && obj_addr < chunk_end,
            "object " PTR_FORMAT " must be within chunk [" PTR_FORMAT ", " PTR_FORMAT "[",
            p2i(obj_addr), p2i(chunk_start), p2i(chunk_end));
+    prefetch_obj(obj_addr);
     do {
       assert(bitmap->is_marked(obj_addr), "inv");
-      prefetch_obj(obj_addr);
+
+      // Only object starts are marked, so the next marked object can be found
+      // without knowing the size of the current one. Prefetch it so that its
+      // header is available by the time the current object has been processed.
+      // Use hr_top as the limit so that we zap dead ranges up to the next
+      // marked obj or hr_top.
+      HeapWord* const next_marked_obj_addr = bitmap->get_next_marked_addr(obj_addr + 1, hr_top);
+      if (next_marked_obj_addr < chunk_end) {
+        prefetch_obj(next_marked_obj_addr);
+      }
 
       oop obj = cast_to_oop(obj_addr);
       const size_t obj_size = obj->size();
@@ -261,9 +280,7 @@ class G1PostEvacuateCollectionSetCleanupTask1::RestoreEvacFailureRegionsTask : p
       }
 
       assert(obj_end_addr <= hr_top, "inv");
-      // Use hr_top as the limit so that we zap dead ranges up to the next
-      // marked obj or hr_top.
-      HeapWord* next_marked_obj_addr = bitmap->get_next_marked_addr(obj_end_addr, hr_top);
+      assert(next_marked_obj_addr >= obj_end_addr, "marked objects must not overlap");
       garbage_words += zap_dead_objects(hr, obj_end_addr, next_marked_obj_addr);
       obj_addr = next_marked_obj_addr;
     } while (obj_addr < chunk_end);
@@ -390,8 +407,8 @@ class G1FreeHumongousRegionClosure : public HeapRegionIndexClosure {
     G1HeapRegion* r = _g1h->region_at(region_index);
 
     oop obj = cast_to_oop(r->bottom());
-    guarantee(obj->is_typeArray(),
-              "Only eagerly reclaiming type arrays is supported, but the object "
+    guarantee(G1CollectedHeap::is_eager_reclaim_kind(obj),
+              "Only eagerly reclaiming type and object arrays is supported, but the object "
               PTR_FORMAT " is not.", p2i(r->bottom()));
 
     log_debug(gc, humongous)("Reclaimed humongous region %u (object size " SIZE_FORMAT " @ " PTR_FORMAT ")",
@@ -640,6 +657,8 @@ class FreeCSetStats {
   size_t _failure_used_words;  // Live size in failed regions
   size_t _failure_waste_words; // Wasted size in failed regions
   size_t _card_rs_length;      // (Card Set) Remembered set size
+  size_t _eden_copied_bytes;   // Bytes copied from eden regions
+  size_t _survivor_copied_bytes; // Bytes copied from survivor regions
   uint _regions_freed;         // Number of regions freed
 
 public:
@@ -650,6 +669,8 @@ class FreeCSetStats {
       _failure_used_words(0),
       _failure_waste_words(0),
       _card_rs_length(0),
+      _eden_copied_bytes(0),
+      _survivor_copied_bytes(0),
       _regions_freed(0) { }
 
   void merge_stats(FreeCSetStats* other) {
@@ -660,6 +681,8 @@ class FreeCSetStats {
     _failure_used_words += other->_failure_used_words;
     _failure_waste_words += other->_failure_waste_words;
     _card_rs_length += other->_card_rs_length;
+    _eden_copied_bytes += other->_eden_copied_bytes;
+    _survivor_copied_bytes += other->_survivor_copied_bytes;
     _regions_freed += other->_regions_freed;
   }
 
@@ -674,6 +697,7 @@ class FreeCSetStats {
     G1Policy *policy = g1h->policy();
     policy->old_gen_alloc_tracker()->add_allocated_bytes_since_last_gc(_bytes_allocated_in_old_since_last_gc);
     policy->record_card_rs_length(_card_rs_length);
+    policy->record_young_cohort_copied_bytes(_eden_copied_bytes, _survivor_copied_bytes);
     policy->cset_regions_freed();
   }
 
@@ -703,6 +727,14 @@ class FreeCSetStats {
   void account_card_rs_length(G1HeapRegion* r) {
     _card_rs_length += r->rem_set()->occupied();
   }
+
+  void account_young_copied_words(G1HeapRegion* r, size_t copied_words) {
+    if (r->is_eden()) {
+      _eden_copied_bytes += copied_words * HeapWordSize;
+    } else {
+      _survivor_copied_bytes += copied_words * HeapWordSize;
+    }
+  }
 };
 
 // Closure applied to all regions in the collection set.
@@ -826,7 +858,9 @@ class FreeCSetClosure : public HeapRegionClosure {
 
     if (r->is_young()) {
       assert_tracks_surviving_words(r);
-      r->record_surv_words_in_group(_surviving_young_words[r->young_index_in_cset()]);
+      size_t surviving_words = _surviving_young_words[r->young_index_in_cset()];
+      r->record_surv_words_in_group(surviving_words);
+      stats()->account_young_copied_words(r, surviving_words);
     }
 
     if (_evac_failure_regions->contains(r->hrm_index())) {
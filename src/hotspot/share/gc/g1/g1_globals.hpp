@@ -156,6 +156,12 @@
           "the buffer will be enqueued for processing.")                    \
           range(0, 100)                                                     \
                                                                             \
+  product(bool, G1SATBFilterBeforeEnqueue, true, EXPERIMENTAL,              \
+          "Filter full SATB buffers in the mutator thread before "          \
+          "enqueueing them. If disabled, full buffers are enqueued "        \
+          "as-is and are only filtered by concurrent marking, which "       \
+          "reduces mutator stalls at the cost of more marking work.")       \
+                                                                            \
   product(uint, G1ExpandByPercentOfAvailable, 20, EXPERIMENTAL,             \
           "When expanding, % of uncommitted space to claim.")               \
           range(0, 100)                                                     \
@@ -174,6 +180,11 @@
           "Control whether concurrent refinement is performed. "            \
           "Disabling effectively ignores G1RSetUpdatingPauseTimePercent")   \
                                                                             \
+  product(bool, G1UseCardTableRefinement, false, EXPERIMENTAL,              \
+          "Mutator post-barriers only dirty cards in the card table "       \
+          "instead of logging them into dirty card queues. Refinement "     \
+          "threads find dirty cards by sweeping the card table.")           \
+                                                                            \
   develop(uint, G1RemSetArrayOfCardsEntriesBase, 8,                         \
           "Maximum number of entries per region in the Array of Cards "     \
           "card set container per MB of a heap region.")                    \
@@ -267,6 +278,10 @@
           "otherwise eligible for eager reclaim may have to be a candidate "\
           "for eager reclaim. Will be selected ergonomically by default.")  \
                                                                             \
+  product(bool, G1EagerReclaimHumongousObjArrays, true, EXPERIMENTAL,       \
+          "Also consider humongous object arrays for eager reclaim. Type "  \
+          "arrays are always considered.")                                  \
+                                                                            \
   product(size_t, G1RebuildRemSetChunkSize, 256 * K, EXPERIMENTAL,          \
           "Chunk size used for rebuilding the remembered set.")             \
           range(4 * K, 32 * M)                                              \
@@ -299,6 +314,19 @@
           "disables this check.")                                           \
           range(0.0, (double)max_uintx)                                     \
                                                                             \
+  product(uintx, G1MemoryPressureUncommitInterval, 0, EXPERIMENTAL,         \
+          "Number of milliseconds between checks of the container memory "  \
+          "pressure. While the memory pressure is high, free regions are "  \
+          "uncommitted concurrently. A value of zero disables these "       \
+          "checks. Requires cgroups v2 with pressure stall information.")   \
+                                                                            \
+  product(double, G1MemoryPressureUncommitThreshold, 10.0, EXPERIMENTAL,    \
+          "Percentage of time tasks of the container stalled on memory "    \
+          "over the last ten seconds at which G1 starts uncommitting free " \
+          "regions. Uncommitting stops when the pressure drops below half " \
+          "of this value.")                                                 \
+          range(0.0, 100.0)                                                 \
+                                                                            \
   product(uint, G1RemSetFreeMemoryRescheduleDelayMillis, 10, EXPERIMENTAL,  \
           "Time after which the card set free memory task reschedules "     \
           "itself if there is work remaining.")                             \
@@ -334,6 +362,22 @@
           "scan cost related prediction samples. A sample must involve "    \
           "the same or more than this number of code roots to be used.")    \
                                                                             \
+  product(bool, G1UseCohortCopyCostModel, false, EXPERIMENTAL,              \
+          "Separately estimate the cost to copy objects from eden and "     \
+          "from survivor regions when predicting young collection times.")  \
+                                                                            \
+  product(bool, G1NUMAAwarePromotion, false, EXPERIMENTAL,                  \
+          "Promote objects into old regions on the same memory node as "    \
+          "the region they are evacuated from. Only has an effect with "    \
+          "UseNUMA on systems with multiple active memory nodes.")          \
+                                                                            \
+  product(uint, G1MutatorAllocRegionStripes, 1, EXPERIMENTAL,              \
+          "Number of mutator allocation regions per memory node that "      \
+          "threads allocate TLABs and objects from concurrently. Threads "  \
+          "are distributed across the regions of their node to reduce "     \
+          "contention on the allocation top.")                              \
+          range(1, 64)                                                      \
+                                                                            \
   GC_G1_EVACUATION_FAILURE_FLAGS(develop,                                   \
                     develop_pd,                                             \
                     product,                                                \
@@ -24,6 +24,8 @@
 
 #include "precompiled.hpp"
 #include "gc/parallel/mutableSpace.hpp"
+#include "gc/parallel/parallelScavengeHeap.hpp"
+#include "gc/shared/concurrentPretouchThread.hpp"
 #include "gc/shared/pretouchTask.hpp"
 #include "memory/iterator.inline.hpp"
 #include "memory/universe.hpp"
@@ -114,11 +116,18 @@ void MutableSpace::initialize(MemRegion mr,
 
     if (AlwaysPreTouch) {
       size_t pretouch_page_size = UseLargePages ? page_size : os::vm_page_size();
-      PretouchTask::pretouch("ParallelGC PreTouch head", (char*)head.start(), (char*)head.end(),
-                             pretouch_page_size, pretouch_workers);
-
-      PretouchTask::pretouch("ParallelGC PreTouch tail", (char*)tail.start(), (char*)tail.end(),
-                             pretouch_page_size, pretouch_workers);
+      ConcurrentPretouchThread* pretouch_thread = ParallelScavengeHeap::heap()->pretouch_thread();
+      // During initial heap setup leave the pre-touching to the background
+      // thread, as long as it has room for the ranges.
+      bool concurrent = pretouch_thread != nullptr && !pretouch_thread->is_started();
+      if (!concurrent || !pretouch_thread->add_range(head, pretouch_page_size)) {
+        PretouchTask::pretouch("ParallelGC PreTouch head", (char*)head.start(), (char*)head.end(),
+                               pretouch_page_size, pretouch_workers);
+      }
+      if (!concurrent || !pretouch_thread->add_range(tail, pretouch_page_size)) {
+        PretouchTask::pretouch("ParallelGC PreTouch tail", (char*)tail.start(), (char*)tail.end(),
+                               pretouch_page_size, pretouch_workers);
+      }
     }
 
     // Remember where we stopped so that we can continue later.
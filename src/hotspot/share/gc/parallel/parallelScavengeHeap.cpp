@@ -83,6 +83,12 @@ jint ParallelScavengeHeap::initialize() {
   // Set up WorkerThreads
   _workers.initialize_workers();
 
+  if (ConcurrentPretouchThread::is_enabled()) {
+    // Collects the initial spaces to pre-touch while the generations are
+    // set up below, and gets started once the heap is fully initialized.
+    _pretouch_thread = new ConcurrentPretouchThread();
+  }
+
   // Create and initialize the generations.
   _young_gen = new PSYoungGen(
       young_rs,
@@ -159,14 +165,22 @@ void ParallelScavengeHeap::initialize_serviceability() {
 
 }
 
+void ParallelScavengeHeap::stop() {
+  // Stop the pre-touch thread so that it does not keep touching memory, or
+  // logging, while the VM shuts down.
+  if (_pretouch_thread != nullptr && _pretouch_thread->is_started()) {
+    _pretouch_thread->stop();
+  }
+}
+
 void ParallelScavengeHeap::safepoint_synchronize_begin() {
-  if (UseStringDeduplication) {
+  if (UseStringDeduplication || _pretouch_thread != nullptr) {
     SuspendibleThreadSet::synchronize();
   }
 }
 
 void ParallelScavengeHeap::safepoint_synchronize_end() {
-  if (UseStringDeduplication) {
+  if (UseStringDeduplication || _pretouch_thread != nullptr) {
     SuspendibleThreadSet::desynchronize();
   }
 }
@@ -186,6 +200,10 @@ void ParallelScavengeHeap::post_initialize() {
   PSPromotionManager::initialize();
 
   ScavengableNMethods::initialize(&_is_scavengable);
+
+  if (_pretouch_thread != nullptr) {
+    _pretouch_thread->start();
+  }
 }
 
 void ParallelScavengeHeap::update_counters() {
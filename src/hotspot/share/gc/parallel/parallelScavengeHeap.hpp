@@ -30,6 +30,7 @@
 #include "gc/parallel/psYoungGen.hpp"
 #include "gc/shared/cardTableBarrierSet.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/concurrentPretouchThread.hpp"
 #include "gc/shared/gcPolicyCounters.hpp"
 #include "gc/shared/gcWhen.hpp"
 #include "gc/shared/preGCValues.hpp"
@@ -86,6 +87,9 @@ class ParallelScavengeHeap : public CollectedHeap {
 
   WorkerThreads _workers;
 
+  // Only set with ConcurrentPreTouch.
+  ConcurrentPretouchThread* _pretouch_thread;
+
   void initialize_serviceability() override;
 
   void trace_actual_reserved_page_size(const size_t reserved_heap_size, const ReservedSpace rs);
@@ -112,7 +116,8 @@ class ParallelScavengeHeap : public CollectedHeap {
     _eden_pool(nullptr),
     _survivor_pool(nullptr),
     _old_pool(nullptr),
-    _workers("GC Thread", ParallelGCThreads) { }
+    _workers("GC Thread", ParallelGCThreads),
+    _pretouch_thread(nullptr) { }
 
   Name kind() const override {
     return CollectedHeap::Parallel;
@@ -142,6 +147,8 @@ class ParallelScavengeHeap : public CollectedHeap {
   // Returns JNI_OK on success
   jint initialize() override;
 
+  void stop() override;
+
   void safepoint_synchronize_begin() override;
   void safepoint_synchronize_end() override;
 
@@ -246,6 +253,8 @@ class ParallelScavengeHeap : public CollectedHeap {
   GCMemoryManager* old_gc_manager() const { return _old_manager; }
   GCMemoryManager* young_gc_manager() const { return _young_manager; }
 
+  ConcurrentPretouchThread* pretouch_thread() const { return _pretouch_thread; }
+
   WorkerThreads& workers() {
     return _workers;
   }
@@ -41,7 +41,13 @@
           "for a system GC")                                                \
                                                                             \
   product(bool, PSChunkLargeArrays, true,                                   \
-          "Process large arrays in chunks")
+          "Process large arrays in chunks")                                 \
+                                                                            \
+  product(bool, UseNUMAPromotion, false, EXPERIMENTAL,                      \
+          "With UseNUMA, place the old generation memory filled by "        \
+          "promotion, in chunks of several megabytes, on the NUMA node "    \
+          "of the first GC worker promoting into each chunk, instead of "   \
+          "interleaving it across all nodes")
 
 // end of GC_PARALLEL_FLAGS
 
@@ -51,6 +51,7 @@
 #include "gc/shared/gcTimer.hpp"
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
+#include "gc/shared/gcWorkerEfficiency.hpp"
 #include "gc/shared/isGCActiveMark.hpp"
 #include "gc/shared/oopStorage.inline.hpp"
 #include "gc/shared/oopStorageSet.inline.hpp"
@@ -465,50 +466,7 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
         return false;
       }
 
-      // Compute the destination_count for cur_region, and if necessary, update
-      // source_region for a destination region.  The source_region field is
-      // updated if cur_region is the first (left-most) region to be copied to a
-      // destination region.
-      //
-      // The destination_count calculation is a bit subtle.  A region that has
-      // data that compacts into itself does not count itself as a destination.
-      // This maintains the invariant that a zero count means the region is
-      // available and can be claimed and then filled.
-      uint destination_count = 0;
-      if (split_info.is_split(cur_region)) {
-        // The current region has been split:  the partial object will be copied
-        // to one destination space and the remaining data will be copied to
-        // another destination space.  Adjust the initial destination_count and,
-        // if necessary, set the source_region field if the partial object will
-        // cross a destination region boundary.
-        destination_count = split_info.destination_count();
-        if (destination_count == 2) {
-          size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
-          _region_data[dest_idx].set_source_region(cur_region);
-        }
-      }
-
-      HeapWord* const last_addr = dest_addr + words - 1;
-      const size_t dest_region_1 = addr_to_region_idx(dest_addr);
-      const size_t dest_region_2 = addr_to_region_idx(last_addr);
-
-      // Initially assume that the destination regions will be the same and
-      // adjust the value below if necessary.  Under this assumption, if
-      // cur_region == dest_region_2, then cur_region will be compacted
-      // completely into itself.
-      destination_count += cur_region == dest_region_2 ? 0 : 1;
-      if (dest_region_1 != dest_region_2) {
-        // Destination regions differ; adjust destination_count.
-        destination_count += 1;
-        // Data from cur_region will be copied to the start of dest_region_2.
-        _region_data[dest_region_2].set_source_region(cur_region);
-      } else if (is_region_aligned(dest_addr)) {
-        // Data from cur_region will be copied to the start of the destination
-        // region.
-        _region_data[dest_region_1].set_source_region(cur_region);
-      }
-
-      _region_data[cur_region].set_destination_count(destination_count);
+      summarize_region(split_info, cur_region, dest_addr, words);
       dest_addr += words;
     }
 
@@ -519,6 +477,72 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
   return true;
 }
 
+HeapWord* ParallelCompactData::summarize_range(const SplitInfo& split_info,
+                                               size_t beg_region, size_t end_region,
+                                               HeapWord* dest_addr)
+{
+  for (size_t cur_region = beg_region; cur_region < end_region; ++cur_region) {
+    _region_data[cur_region].set_destination(dest_addr);
+
+    size_t words = _region_data[cur_region].data_size();
+    if (words > 0) {
+      summarize_region(split_info, cur_region, dest_addr, words);
+      dest_addr += words;
+    }
+  }
+  return dest_addr;
+}
+
+void ParallelCompactData::summarize_region(const SplitInfo& split_info,
+                                           size_t cur_region, HeapWord* dest_addr,
+                                           size_t words)
+{
+  // Compute the destination_count for cur_region, and if necessary, update
+  // source_region for a destination region.  The source_region field is
+  // updated if cur_region is the first (left-most) region to be copied to a
+  // destination region.
+  //
+  // The destination_count calculation is a bit subtle.  A region that has
+  // data that compacts into itself does not count itself as a destination.
+  // This maintains the invariant that a zero count means the region is
+  // available and can be claimed and then filled.
+  uint destination_count = 0;
+  if (split_info.is_split(cur_region)) {
+    // The current region has been split:  the partial object will be copied
+    // to one destination space and the remaining data will be copied to
+    // another destination space.  Adjust the initial destination_count and,
+    // if necessary, set the source_region field if the partial object will
+    // cross a destination region boundary.
+    destination_count = split_info.destination_count();
+    if (destination_count == 2) {
+      size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
+      _region_data[dest_idx].set_source_region(cur_region);
+    }
+  }
+
+  HeapWord* const last_addr = dest_addr + words - 1;
+  const size_t dest_region_1 = addr_to_region_idx(dest_addr);
+  const size_t dest_region_2 = addr_to_region_idx(last_addr);
+
+  // Initially assume that the destination regions will be the same and
+  // adjust the value below if necessary.  Under this assumption, if
+  // cur_region == dest_region_2, then cur_region will be compacted
+  // completely into itself.
+  destination_count += cur_region == dest_region_2 ? 0 : 1;
+  if (dest_region_1 != dest_region_2) {
+    // Destination regions differ; adjust destination_count.
+    destination_count += 1;
+    // Data from cur_region will be copied to the start of dest_region_2.
+    _region_data[dest_region_2].set_source_region(cur_region);
+  } else if (is_region_aligned(dest_addr)) {
+    // Data from cur_region will be copied to the start of the destination
+    // region.
+    _region_data[dest_region_1].set_source_region(cur_region);
+  }
+
+  _region_data[cur_region].set_destination_count(destination_count);
+}
+
 #ifdef ASSERT
 void ParallelCompactData::verify_clear(const PSVirtualSpace* vspace)
 {
@@ -540,6 +564,7 @@ ParallelOldTracer   PSParallelCompact::_gc_tracer;
 elapsedTimer        PSParallelCompact::_accumulated_time;
 unsigned int        PSParallelCompact::_maximum_compaction_gc_num = 0;
 CollectorCounters*  PSParallelCompact::_counters = nullptr;
+GCWorkerEfficiency  PSParallelCompact::_worker_efficiency;
 ParMarkBitMap       PSParallelCompact::_mark_bitmap;
 ParallelCompactData PSParallelCompact::_summary_data;
 
@@ -741,6 +766,25 @@ void PSParallelCompact::post_compact()
   Universe::heap()->record_whole_heap_examined_timestamp();
 }
 
+// Split [start, end) evenly for a number of workers and return the
+// range for worker_id.
+static void split_regions_for_worker(size_t start, size_t end,
+                                     uint worker_id, uint num_workers,
+                                     size_t* worker_start, size_t* worker_end) {
+  assert(start < end, "precondition");
+  assert(num_workers > 0, "precondition");
+  assert(worker_id < num_workers, "precondition");
+
+  size_t num_regions = end - start;
+  size_t num_regions_per_worker = num_regions / num_workers;
+  size_t remainder = num_regions % num_workers;
+  // The first few workers will get one extra.
+  *worker_start = start + worker_id * num_regions_per_worker
+                  + MIN2(checked_cast<size_t>(worker_id), remainder);
+  *worker_end = *worker_start + num_regions_per_worker
+                + (worker_id < remainder ? 1 : 0);
+}
+
 HeapWord* PSParallelCompact::compute_dense_prefix_for_old_space(MutableSpace* old_space,
                                                                 HeapWord* full_region_prefix_end) {
   const size_t region_size = ParallelCompactData::RegionSize;
@@ -851,6 +895,190 @@ bool PSParallelCompact::reassess_maximum_compaction(bool maximum_compaction,
   return false;
 }
 
+// Below this many old-gen regions per worker the summary is done serially,
+// as the per-region work is too small to pay for starting the workers.
+static const size_t MinParallelSummaryRegionsPerWorker = 256;
+
+static bool use_parallel_summary(size_t num_regions, uint num_workers) {
+  return num_workers > 1 && num_regions >= MinParallelSummaryRegionsPerWorker * num_workers;
+}
+
+size_t PSParallelCompact::live_words_in_old_space(HeapWord** full_region_prefix_end) {
+  MutableSpace* const old_space = _space_info[old_space_id].space();
+  const size_t beg_region = _summary_data.addr_to_region_idx(old_space->bottom());
+  const size_t end_region = _summary_data.addr_to_region_idx(_summary_data.region_align_up(old_space->top()));
+  const uint num_workers = ParallelScavengeHeap::heap()->workers().active_workers();
+
+  if (!use_parallel_summary(end_region - beg_region, num_workers)) {
+    return _summary_data.live_words_in_space(old_space, full_region_prefix_end);
+  }
+
+  struct LiveWordsTask final : public WorkerTask {
+    const size_t _beg_region;
+    const size_t _end_region;
+    const uint   _num_workers;
+    size_t* const _live_words;
+    size_t* const _first_not_full;
+
+    LiveWordsTask(size_t beg_region, size_t end_region, uint num_workers) :
+      WorkerTask("PSLiveWords task"),
+      _beg_region(beg_region),
+      _end_region(end_region),
+      _num_workers(num_workers),
+      _live_words(NEW_C_HEAP_ARRAY(size_t, num_workers, mtGC)),
+      _first_not_full(NEW_C_HEAP_ARRAY(size_t, num_workers, mtGC)) {}
+
+    ~LiveWordsTask() {
+      FREE_C_HEAP_ARRAY(size_t, _live_words);
+      FREE_C_HEAP_ARRAY(size_t, _first_not_full);
+    }
+
+    void work(uint worker_id) override {
+      size_t start_region;
+      size_t end_region;
+      split_regions_for_worker(_beg_region, _end_region,
+                               worker_id, _num_workers,
+                               &start_region, &end_region);
+      const ParallelCompactData& sd = summary_data();
+      size_t live_words = 0;
+      size_t first_not_full = _end_region;
+      for (size_t cur_region = start_region; cur_region < end_region; ++cur_region) {
+        size_t live_words_in_region = sd.region(cur_region)->data_size();
+        if (first_not_full == _end_region && live_words_in_region < ParallelCompactData::RegionSize) {
+          first_not_full = cur_region;
+        }
+        live_words += live_words_in_region;
+      }
+      _live_words[worker_id] = live_words;
+      _first_not_full[worker_id] = first_not_full;
+    }
+  } task(beg_region, end_region, num_workers);
+  ParallelScavengeHeap::heap()->workers().run_task(&task, num_workers);
+
+  size_t live_words = 0;
+  size_t first_not_full = end_region;
+  for (uint i = 0; i < num_workers; ++i) {
+    live_words += task._live_words[i];
+    first_not_full = MIN2(first_not_full, task._first_not_full[i]);
+  }
+
+  if (first_not_full == end_region) {
+    // All regions are full of live objs.
+    assert(_summary_data.is_region_aligned(old_space->top()), "inv");
+    *full_region_prefix_end = old_space->top();
+  } else {
+    *full_region_prefix_end = _summary_data.region_to_addr(first_not_full);
+  }
+  return live_words;
+}
+
+void PSParallelCompact::summarize_old_space(HeapWord* dense_prefix_end) {
+  MutableSpace* const old_space = _space_info[old_space_id].space();
+  SplitInfo& split_info = _space_info[old_space_id].split_info();
+  const size_t beg_region = _summary_data.addr_to_region_idx(old_space->bottom());
+  const size_t dense_prefix_region = _summary_data.addr_to_region_idx(dense_prefix_end);
+  const size_t end_region = _summary_data.addr_to_region_idx(_summary_data.region_align_up(old_space->top()));
+  const uint num_workers = ParallelScavengeHeap::heap()->workers().active_workers();
+
+  if (!use_parallel_summary(end_region - beg_region, num_workers)) {
+    if (dense_prefix_end != old_space->bottom()) {
+      _summary_data.summarize_dense_prefix(old_space->bottom(), dense_prefix_end);
+    }
+    _summary_data.summarize(split_info,
+                            dense_prefix_end, old_space->top(), nullptr,
+                            dense_prefix_end, old_space->end(),
+                            _space_info[old_space_id].new_top_addr());
+    return;
+  }
+
+  // The old space compacts into itself, so no region is split and every region
+  // can be summarized once the destination of the first region in its range is
+  // known.  That is the sum of live words in all ranges before it, computed by
+  // the first pass.
+  assert(!split_info.is_valid(), "old space is never split");
+
+  struct SummarizeTask final : public WorkerTask {
+    const SplitInfo& _split_info;
+    const size_t     _beg_region;
+    const size_t     _dense_prefix_region;
+    const size_t     _end_region;
+    const uint       _num_workers;
+    bool             _assign;
+    size_t* const    _words;
+    HeapWord** const _destinations;
+
+    SummarizeTask(const SplitInfo& split_info, size_t beg_region, size_t dense_prefix_region,
+                  size_t end_region, uint num_workers) :
+      WorkerTask("PSSummarize task"),
+      _split_info(split_info),
+      _beg_region(beg_region),
+      _dense_prefix_region(dense_prefix_region),
+      _end_region(end_region),
+      _num_workers(num_workers),
+      _assign(false),
+      _words(NEW_C_HEAP_ARRAY(size_t, num_workers, mtGC)),
+      _destinations(NEW_C_HEAP_ARRAY(HeapWord*, num_workers, mtGC)) {}
+
+    ~SummarizeTask() {
+      FREE_C_HEAP_ARRAY(size_t, _words);
+      FREE_C_HEAP_ARRAY(HeapWord*, _destinations);
+    }
+
+    void work(uint worker_id) override {
+      ParallelCompactData& sd = summary_data();
+      if (!_assign) {
+        // First pass: dense prefix, and live words of the compacted range.
+        if (_beg_region < _dense_prefix_region) {
+          size_t start_region;
+          size_t end_region;
+          split_regions_for_worker(_beg_region, _dense_prefix_region,
+                                   worker_id, _num_workers,
+                                   &start_region, &end_region);
+          if (start_region < end_region) {
+            sd.summarize_dense_prefix(sd.region_to_addr(start_region), sd.region_to_addr(end_region));
+          }
+        }
+        size_t words = 0;
+        if (_dense_prefix_region < _end_region) {
+          size_t start_region;
+          size_t end_region;
+          split_regions_for_worker(_dense_prefix_region, _end_region,
+                                   worker_id, _num_workers,
+                                   &start_region, &end_region);
+          for (size_t cur_region = start_region; cur_region < end_region; ++cur_region) {
+            words += sd.region(cur_region)->data_size();
+          }
+        }
+        _words[worker_id] = words;
+      } else if (_dense_prefix_region < _end_region) {
+        // Second pass: destinations.
+        size_t start_region;
+        size_t end_region;
+        split_regions_for_worker(_dense_prefix_region, _end_region,
+                                 worker_id, _num_workers,
+                                 &start_region, &end_region);
+        HeapWord* next = sd.summarize_range(_split_info, start_region, end_region, _destinations[worker_id]);
+        assert(next == _destinations[worker_id] + _words[worker_id], "live words changed");
+      }
+    }
+  } task(split_info, beg_region, dense_prefix_region, end_region, num_workers);
+
+  WorkerThreads& workers = ParallelScavengeHeap::heap()->workers();
+  workers.run_task(&task, num_workers);
+
+  HeapWord* dest_addr = dense_prefix_end;
+  for (uint i = 0; i < num_workers; ++i) {
+    task._destinations[i] = dest_addr;
+    dest_addr += task._words[i];
+  }
+  assert(dest_addr <= old_space->end(), "old space must fit into itself");
+
+  task._assign = true;
+  workers.run_task(&task, num_workers);
+
+  _space_info[old_space_id].set_new_top(dest_addr);
+}
+
 void PSParallelCompact::summary_phase(bool maximum_compaction)
 {
   GCTraceTime(Info, gc, phases) tm("Summary Phase", &_gc_timer);
@@ -861,8 +1089,7 @@ void PSParallelCompact::summary_phase(bool maximum_compaction)
     HeapWord* full_region_prefix_end = nullptr;
     {
       // old-gen
-      size_t live_words = _summary_data.live_words_in_space(old_space,
-                                                            &full_region_prefix_end);
+      size_t live_words = live_words_in_old_space(&full_region_prefix_end);
       total_live_words += live_words;
     }
     // young-gen
@@ -887,12 +1114,8 @@ void PSParallelCompact::summary_phase(bool maximum_compaction)
 
     if (dense_prefix_end != old_space->bottom()) {
       fill_dense_prefix_end(id);
-      _summary_data.summarize_dense_prefix(old_space->bottom(), dense_prefix_end);
     }
-    _summary_data.summarize(_space_info[id].split_info(),
-                            dense_prefix_end, old_space->top(), nullptr,
-                            dense_prefix_end, old_space->end(),
-                            _space_info[id].new_top_addr());
+    summarize_old_space(dense_prefix_end);
   }
 
   // Summarize the remaining spaces in the young gen.  The initial target space
@@ -1008,11 +1231,12 @@ bool PSParallelCompact::invoke_no_policy(bool maximum_heap_compaction) {
   const PreGenGCValues pre_gc_values = heap->get_pre_gc_values();
 
   {
-    const uint active_workers =
+    const uint active_workers = _worker_efficiency.limit_active_workers(
       WorkerPolicy::calc_active_workers(ParallelScavengeHeap::heap()->workers().max_workers(),
                                         ParallelScavengeHeap::heap()->workers().active_workers(),
-                                        Threads::number_of_non_daemon_threads());
+                                        Threads::number_of_non_daemon_threads()));
     ParallelScavengeHeap::heap()->workers().set_active_workers(active_workers);
+    GCWorkerEfficiencyMark wem(&_worker_efficiency, &ParallelScavengeHeap::heap()->workers());
 
     GCTraceCPUTime tcpu(&_gc_tracer);
     GCTraceTime(Info, gc) tm("Pause Full", nullptr, gc_cause, true);
@@ -1522,25 +1746,6 @@ void PSParallelCompact::adjust_pointers() {
   ParallelScavengeHeap::heap()->workers().run_task(&task);
 }
 
-// Split [start, end) evenly for a number of workers and return the
-// range for worker_id.
-static void split_regions_for_worker(size_t start, size_t end,
-                                     uint worker_id, uint num_workers,
-                                     size_t* worker_start, size_t* worker_end) {
-  assert(start < end, "precondition");
-  assert(num_workers > 0, "precondition");
-  assert(worker_id < num_workers, "precondition");
-
-  size_t num_regions = end - start;
-  size_t num_regions_per_worker = num_regions / num_workers;
-  size_t remainder = num_regions % num_workers;
-  // The first few workers will get one extra.
-  *worker_start = start + worker_id * num_regions_per_worker
-                  + MIN2(checked_cast<size_t>(worker_id), remainder);
-  *worker_end = *worker_start + num_regions_per_worker
-                + (worker_id < remainder ? 1 : 0);
-}
-
 void PSParallelCompact::forward_to_new_addr() {
   GCTraceTime(Info, gc, phases) tm("Forward", &_gc_timer);
   uint nworkers = ParallelScavengeHeap::heap()->workers().active_workers();
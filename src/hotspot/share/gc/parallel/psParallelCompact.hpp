@@ -31,6 +31,7 @@
 #include "gc/parallel/parMarkBitMap.hpp"
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/collectorCounters.hpp"
+#include "gc/shared/gcWorkerEfficiency.hpp"
 #include "gc/shared/referenceProcessor.hpp"
 #include "gc/shared/taskTerminator.hpp"
 #include "oops/oop.hpp"
@@ -373,6 +374,14 @@ class ParallelCompactData
                  HeapWord* target_beg, HeapWord* target_end,
                  HeapWord** target_next);
 
+  // Summarize the regions [beg_region, end_region) of a space that compacts
+  // into itself, where dest_addr is the destination of beg_region.  Returns
+  // the destination following the last live word.  Disjoint ranges may be
+  // summarized concurrently, see PSParallelCompact::summarize_old_space().
+  HeapWord* summarize_range(const SplitInfo& split_info,
+                            size_t beg_region, size_t end_region,
+                            HeapWord* dest_addr);
+
   void clear_range(size_t beg_region, size_t end_region);
   void clear_range(HeapWord* beg, HeapWord* end) {
     clear_range(addr_to_region_idx(beg), addr_to_region_idx(end));
@@ -401,6 +410,11 @@ class ParallelCompactData
   bool initialize_region_data(size_t heap_size);
   PSVirtualSpace* create_vspace(size_t count, size_t element_size);
 
+  // Set up the destination_count and source_region fields for cur_region,
+  // whose words of live data are copied to dest_addr.
+  void summarize_region(const SplitInfo& split_info, size_t cur_region,
+                        HeapWord* dest_addr, size_t words);
+
   HeapWord*       _heap_start;
 #ifdef  ASSERT
   HeapWord*       _heap_end;
@@ -701,6 +715,7 @@ class PSParallelCompact : AllStatic {
   static elapsedTimer         _accumulated_time;
   static unsigned int         _maximum_compaction_gc_num;
   static CollectorCounters*   _counters;
+  static GCWorkerEfficiency   _worker_efficiency;
   static ParMarkBitMap        _mark_bitmap;
   static ParallelCompactData  _summary_data;
   static IsAliveClosure       _is_alive_closure;
@@ -739,6 +754,12 @@ class PSParallelCompact : AllStatic {
   // make the heap parsable.
   static void fill_dense_prefix_end(SpaceId id);
 
+  // Parallel versions of ParallelCompactData::live_words_in_space() and of
+  // summarizing the old space into itself.  Workers each take a contiguous
+  // range of regions; small old spaces are handled serially.
+  static size_t live_words_in_old_space(HeapWord** full_region_prefix_end);
+  static void summarize_old_space(HeapWord* dense_prefix_end);
+
   static void summary_phase(bool maximum_compaction);
 
   static void adjust_pointers();
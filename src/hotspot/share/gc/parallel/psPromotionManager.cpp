@@ -30,7 +30,9 @@
 #include "gc/parallel/psPromotionManager.inline.hpp"
 #include "gc/parallel/psScavenge.inline.hpp"
 #include "gc/shared/continuationGCSupport.inline.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "gc/shared/gcTrace.hpp"
+#include "gc/shared/partialArrayTaskStepper.inline.hpp"
 #include "gc/shared/preservedMarks.inline.hpp"
 #include "gc/shared/taskqueue.inline.hpp"
 #include "logging/log.hpp"
@@ -42,12 +44,20 @@
 #include "memory/resourceArea.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/compressedOops.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
 
 PaddedEnd<PSPromotionManager>* PSPromotionManager::_manager_array = nullptr;
 PSPromotionManager::PSScannerTasksQueueSet* PSPromotionManager::_stack_array_depth = nullptr;
 PreservedMarksSet*             PSPromotionManager::_preserved_marks_set = nullptr;
 PSOldGen*                      PSPromotionManager::_old_gen = nullptr;
 MutableSpace*                  PSPromotionManager::_young_space = nullptr;
+bool                           PSPromotionManager::_numa_promotion = false;
+size_t                         PSPromotionManager::_numa_chunk_size = 0;
+volatile bool*                 PSPromotionManager::_numa_placed_chunks = nullptr;
+size_t                         PSPromotionManager::_numa_num_chunks = 0;
+uint                           PSPromotionManager::_tolerated_plab_refills = 0;
 
 void PSPromotionManager::initialize() {
   ParallelScavengeHeap* heap = ParallelScavengeHeap::heap();
@@ -55,6 +65,33 @@ void PSPromotionManager::initialize() {
   _old_gen = heap->old_gen();
   _young_space = heap->young_gen()->to_space();
 
+  // Pages can only be placed individually when the old gen does not use large pages.
+  _numa_promotion = UseNUMA && UseNUMAPromotion &&
+                    _old_gen->object_space()->alignment() == os::vm_page_size();
+  if (_numa_promotion) {
+    // Every placement may split the old gen mapping, and too many mappings
+    // make unrelated mmap calls fail (vm.max_map_count on Linux). Place the
+    // old gen in a bounded number of coarse chunks instead of per PLAB.
+    const size_t max_chunks = 4096;
+    const size_t reserved_bytes = _old_gen->reserved().byte_size();
+    _numa_chunk_size = MAX2(align_up(reserved_bytes / max_chunks, os::vm_page_size()), 2 * M);
+    _numa_num_chunks = align_up(reserved_bytes, _numa_chunk_size) / _numa_chunk_size;
+    _numa_placed_chunks = NEW_C_HEAP_ARRAY(volatile bool, _numa_num_chunks, mtGC);
+    for (size_t i = 0; i < _numa_num_chunks; i++) {
+      _numa_placed_chunks[i] = false;
+    }
+  }
+
+  // Assume the last LAB of a worker is half full on average.  Once a worker
+  // has refilled a LAB this often, retiring the last one wastes at most
+  // TargetPLABWastePct of what that worker copied, so it can use larger
+  // LABs.  Pad that a bit, as G1 does.
+  if (ResizePLAB) {
+    _tolerated_plab_refills = (uint)(MAX2(50.0 / TargetPLABWastePct, 1.0) * 1.5);
+  } else {
+    _tolerated_plab_refills = UINT_MAX;
+  }
+
   const uint promotion_manager_num = ParallelGCThreads;
 
   // To prevent false sharing, we pad the PSPromotionManagers
@@ -79,6 +116,27 @@ void PSPromotionManager::initialize() {
   }
 }
 
+void PSPromotionManager::numa_make_local(MemRegion lab) {
+  // The first PLAB in a chunk places the whole committed part of the chunk.
+  // Pages that were touched before keep their node, as they are not migrated.
+  char* const base = (char*)_old_gen->reserved().start();
+  char* const committed_end = (char*)_old_gen->object_space()->end();
+  const size_t first = pointer_delta(lab.start(), base, 1) / _numa_chunk_size;
+  const size_t last = pointer_delta(lab.end() - 1, base, 1) / _numa_chunk_size;
+  assert(last < _numa_num_chunks, "LAB outside of the old gen");
+  for (size_t i = first; i <= last; i++) {
+    if (Atomic::load(&_numa_placed_chunks[i]) ||
+        Atomic::cmpxchg(&_numa_placed_chunks[i], false, true) != false) {
+      continue;
+    }
+    char* start = base + i * _numa_chunk_size;
+    char* end = MIN2(start + _numa_chunk_size, committed_end);
+    if (start < end) {
+      os::numa_make_local(start, pointer_delta(end, start, sizeof(char)), os::numa_get_group_id());
+    }
+  }
+}
+
 // Helper functions to get around the circular dependency between
 // psScavenge.inline.hpp and psPromotionManager.inline.hpp.
 bool PSPromotionManager::should_scavenge(oop* p, bool check_to_space) {
@@ -105,6 +163,13 @@ void PSPromotionManager::pre_scavenge() {
   _preserved_marks_set->assert_empty();
   _young_space = heap->young_gen()->to_space();
 
+  // Resizing the old gen between scavenges replaces the mappings, and with
+  // them the placement. Place each chunk at most once per scavenge, so the
+  // number of mappings stays bounded by the number of chunks.
+  for (size_t i = 0; i < _numa_num_chunks; i++) {
+    _numa_placed_chunks[i] = false;
+  }
+
   for(uint i=0; i<ParallelGCThreads; i++) {
     manager_array(i)->reset();
   }
@@ -172,7 +237,8 @@ void PSPromotionManager::reset_stats() {
 }
 #endif // TASKQUEUE_STATS
 
-PSPromotionManager::PSPromotionManager() {
+PSPromotionManager::PSPromotionManager()
+  : _partial_array_stepper(ParallelGCThreads) {
   // We set the old lab's start array.
   _old_lab.set_start_array(old_gen()->start_array());
 
@@ -200,10 +266,14 @@ void PSPromotionManager::reset() {
   HeapWord* lab_base = young_space()->top();
   _young_lab.initialize(MemRegion(lab_base, (size_t)0));
   _young_gen_is_full = false;
+  _young_plab_size = YoungPLABSize;
+  _young_plab_refills = 0;
 
   lab_base = old_gen()->object_space()->top();
   _old_lab.initialize(MemRegion(lab_base, (size_t)0));
   _old_gen_is_full = false;
+  _old_plab_size = OldPLABSize;
+  _old_plab_refills = 0;
 
   _promotion_failed_info.reset();
 
@@ -287,23 +357,21 @@ void PSPromotionManager::process_array_chunk(PartialArrayScanTask task) {
   TASKQUEUE_STATS_ONLY(++_array_chunks_processed);
 
   oop const obj = old->forwardee();
+  assert(old != obj, "should not be chunking self-forwarded objects");
 
-  int start;
-  int const end = arrayOop(old)->length();
-  if (end > (int) _min_array_size_for_chunking) {
-    // we'll chunk more
-    start = end - _array_chunk_size;
-    assert(start > 0, "invariant");
-    arrayOop(old)->set_length(start);
+  PartialArrayTaskStepper::Step step
+    = _partial_array_stepper.next(objArrayOop(old),
+                                  objArrayOop(obj),
+                                  _array_chunk_size);
+  for (uint i = 0; i < step._ncreate; ++i) {
     push_depth(ScannerTask(PartialArrayScanTask(old)));
-    TASKQUEUE_STATS_ONLY(++_array_chunk_pushes);
-  } else {
-    // this is the final chunk for this array
-    start = 0;
-    int const actual_length = arrayOop(obj)->length();
-    arrayOop(old)->set_length(actual_length);
   }
+  TASKQUEUE_STATS_ONLY(_array_chunk_pushes += step._ncreate);
 
+  // The length of obj is not correct while chunks are outstanding, but
+  // the processing below only relies on start/end.
+  int const start = step._index;
+  int const end = start + (int)_array_chunk_size;
   if (UseCompressedOops) {
     process_array_chunk_work<narrowOop>(obj, start, end);
   } else {
@@ -311,6 +379,34 @@ void PSPromotionManager::process_array_chunk(PartialArrayScanTask task) {
   }
 }
 
+void PSPromotionManager::push_objArray(oop old_obj, oop new_obj) {
+  assert(old_obj->is_objArray(), "precondition");
+  assert(old_obj->is_forwarded(), "precondition");
+  assert(old_obj->forwardee() == new_obj, "precondition");
+  assert(old_obj != new_obj, "should not be chunking self-forwarded objects");
+  assert(new_obj->is_objArray(), "precondition");
+
+  TASKQUEUE_STATS_ONLY(++_arrays_chunked);
+
+  PartialArrayTaskStepper::Step step
+    = _partial_array_stepper.start(objArrayOop(old_obj),
+                                   objArrayOop(new_obj),
+                                   _array_chunk_size);
+
+  // Push the partial scan tasks before processing the initial chunk, so
+  // other workers can steal them while we are busy.
+  for (uint i = 0; i < step._ncreate; ++i) {
+    push_depth(ScannerTask(PartialArrayScanTask(old_obj)));
+  }
+  TASKQUEUE_STATS_ONLY(_array_chunk_pushes += step._ncreate);
+
+  if (UseCompressedOops) {
+    process_array_chunk_work<narrowOop>(new_obj, 0, step._index);
+  } else {
+    process_array_chunk_work<oop>(new_obj, 0, step._index);
+  }
+}
+
 oop PSPromotionManager::oop_promotion_failed(oop obj, markWord obj_mark) {
   assert(_old_gen_is_full || PromotionFailureALot, "Sanity");
 
@@ -28,6 +28,7 @@
 #include "gc/parallel/psPromotionLAB.hpp"
 #include "gc/shared/copyFailedInfo.hpp"
 #include "gc/shared/gcTrace.hpp"
+#include "gc/shared/partialArrayTaskStepper.hpp"
 #include "gc/shared/preservedMarks.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
 #include "gc/shared/taskqueue.hpp"
@@ -55,14 +56,19 @@ class PSPromotionManager {
   friend class ScavengeRootsTask;
 
  private:
-  typedef OverflowTaskQueue<ScannerTask, mtGC>           PSScannerTasksQueue;
-  typedef GenericTaskQueueSet<PSScannerTasksQueue, mtGC> PSScannerTasksQueueSet;
+  typedef StealableOverflowTaskQueue<ScannerTask, mtGC>           PSScannerTasksQueue;
+  typedef StealableOverflowTaskQueueSet<PSScannerTasksQueue, mtGC> PSScannerTasksQueueSet;
 
   static PaddedEnd<PSPromotionManager>* _manager_array;
   static PSScannerTasksQueueSet*        _stack_array_depth;
   static PreservedMarksSet*             _preserved_marks_set;
   static PSOldGen*                      _old_gen;
   static MutableSpace*                  _young_space;
+  static bool                           _numa_promotion;
+  static size_t                         _numa_chunk_size;
+  static volatile bool*                 _numa_placed_chunks;
+  static size_t                         _numa_num_chunks;
+  static uint                           _tolerated_plab_refills;
 
 #if TASKQUEUE_STATS
   size_t                              _array_chunk_pushes;
@@ -81,12 +87,21 @@ class PSPromotionManager {
   bool                                _young_gen_is_full;
   bool                                _old_gen_is_full;
 
+  // The PLAB sizes start at YoungPLABSize and OldPLABSize in every
+  // scavenge, and are doubled each time the LAB was refilled more
+  // often than tolerated during the scavenge.
+  size_t                              _young_plab_size;
+  size_t                              _old_plab_size;
+  uint                                _young_plab_refills;
+  uint                                _old_plab_refills;
+
   PSScannerTasksQueue                 _claimed_stack_depth;
 
   uint                                _target_stack_size;
 
   uint                                _array_chunk_size;
   uint                                _min_array_size_for_chunking;
+  PartialArrayTaskStepper             _partial_array_stepper;
 
   PreservedMarks*                     _preserved_marks;
   PromotionFailedInfo                 _promotion_failed_info;
@@ -102,6 +117,7 @@ class PSPromotionManager {
   template <class T> void  process_array_chunk_work(oop obj,
                                                     int start, int end);
   void process_array_chunk(PartialArrayScanTask task);
+  void push_objArray(oop old_obj, oop new_obj);
 
   void push_depth(ScannerTask task);
 
@@ -111,6 +127,12 @@ class PSPromotionManager {
 
   static PSScannerTasksQueueSet* stack_array_depth() { return _stack_array_depth; }
 
+  // Place the chunks of the old gen overlapped by a new old PLAB on the node
+  // of the current thread, unless they have been placed in this scavenge.
+  static void numa_make_local(MemRegion lab);
+
+  inline static void notify_plab_refill(size_t& plab_size, uint& refills);
+
   template<bool promote_immediately>
   oop copy_unmarked_to_survivor_space(oop o, markWord m);
 
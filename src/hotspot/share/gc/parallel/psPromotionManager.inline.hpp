@@ -34,6 +34,7 @@
 #include "gc/parallel/psScavenge.inline.hpp"
 #include "gc/parallel/psStringDedup.hpp"
 #include "gc/shared/continuationGCSupport.inline.hpp"
+#include "gc/shared/plab.hpp"
 #include "gc/shared/taskqueue.inline.hpp"
 #include "gc/shared/tlab_globals.hpp"
 #include "logging/log.hpp"
@@ -158,6 +159,13 @@ inline oop PSPromotionManager::copy_to_survivor_space(oop o) {
 // into smaller submethods, but we need to be careful not to hurt
 // performance.
 //
+inline void PSPromotionManager::notify_plab_refill(size_t& plab_size, uint& refills) {
+  if (++refills > _tolerated_plab_refills) {
+    refills = 0;
+    plab_size = MIN2(plab_size * 2, PLAB::max_size());
+  }
+}
+
 template<bool promote_immediately>
 inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
                                                                markWord test_mark) {
@@ -177,7 +185,7 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
       new_obj = cast_to_oop(_young_lab.allocate(new_obj_size));
       if (new_obj == nullptr && !_young_gen_is_full) {
         // Do we allocate directly, or flush and refill?
-        if (new_obj_size > (YoungPLABSize / 2)) {
+        if (new_obj_size > (_young_plab_size / 2)) {
           // Allocate this object directly
           new_obj = cast_to_oop(young_space()->cas_allocate(new_obj_size));
           promotion_trace_event(new_obj, o, new_obj_size, age, false, nullptr);
@@ -185,9 +193,15 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
           // Flush and fill
           _young_lab.flush();
 
-          HeapWord* lab_base = young_space()->cas_allocate(YoungPLABSize);
+          HeapWord* lab_base = young_space()->cas_allocate(_young_plab_size);
+          if (lab_base == nullptr && _young_plab_size > YoungPLABSize) {
+            // A boosted LAB may not fit in what's left; retry with the base size.
+            _young_plab_size = YoungPLABSize;
+            lab_base = young_space()->cas_allocate(_young_plab_size);
+          }
           if (lab_base != nullptr) {
-            _young_lab.initialize(MemRegion(lab_base, YoungPLABSize));
+            _young_lab.initialize(MemRegion(lab_base, _young_plab_size));
+            notify_plab_refill(_young_plab_size, _young_plab_refills);
             // Try the young lab allocation again.
             new_obj = cast_to_oop(_young_lab.allocate(new_obj_size));
             promotion_trace_event(new_obj, o, new_obj_size, age, false, &_young_lab);
@@ -213,7 +227,7 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
     if (new_obj == nullptr) {
       if (!_old_gen_is_full) {
         // Do we allocate directly, or flush and refill?
-        if (new_obj_size > (OldPLABSize / 2)) {
+        if (new_obj_size > (_old_plab_size / 2)) {
           // Allocate this object directly
           new_obj = cast_to_oop(old_gen()->allocate(new_obj_size));
           promotion_trace_event(new_obj, o, new_obj_size, age, true, nullptr);
@@ -221,9 +235,18 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
           // Flush and fill
           _old_lab.flush();
 
-          HeapWord* lab_base = old_gen()->allocate(OldPLABSize);
+          HeapWord* lab_base = old_gen()->allocate(_old_plab_size);
+          if (lab_base == nullptr && _old_plab_size > OldPLABSize) {
+            // A boosted LAB may not fit in what's left; retry with the base size.
+            _old_plab_size = OldPLABSize;
+            lab_base = old_gen()->allocate(_old_plab_size);
+          }
           if(lab_base != nullptr) {
-            _old_lab.initialize(MemRegion(lab_base, OldPLABSize));
+            if (_numa_promotion) {
+              numa_make_local(MemRegion(lab_base, _old_plab_size));
+            }
+            _old_lab.initialize(MemRegion(lab_base, _old_plab_size));
+            notify_plab_refill(_old_plab_size, _old_plab_refills);
             // Try the old lab allocation again.
             new_obj = cast_to_oop(_old_lab.allocate(new_obj_size));
             promotion_trace_event(new_obj, o, new_obj_size, age, true, &_old_lab);
@@ -279,8 +302,7 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
         new_obj->is_objArray() &&
         PSChunkLargeArrays) {
       // we'll chunk it
-      push_depth(ScannerTask(PartialArrayScanTask(o)));
-      TASKQUEUE_STATS_ONLY(++_arrays_chunked; ++_array_chunk_pushes);
+      push_objArray(o, new_obj);
     } else {
       // we'll just push its contents
       push_contents(new_obj);
@@ -42,6 +42,7 @@
 #include "gc/shared/gcTimer.hpp"
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
+#include "gc/shared/gcWorkerEfficiency.hpp"
 #include "gc/shared/isGCActiveMark.hpp"
 #include "gc/shared/oopStorage.inline.hpp"
 #include "gc/shared/oopStorageSetParState.inline.hpp"
@@ -82,6 +83,7 @@ elapsedTimer                  PSScavenge::_accumulated_time;
 STWGCTimer                    PSScavenge::_gc_timer;
 ParallelScavengeTracer        PSScavenge::_gc_tracer;
 CollectorCounters*            PSScavenge::_counters = nullptr;
+GCWorkerEfficiency            PSScavenge::_worker_efficiency;
 
 static void scavenge_roots_work(ParallelRootType::Value root_type, uint worker_id) {
   assert(ParallelScavengeHeap::heap()->is_stw_gc_active(), "called outside gc");
@@ -434,11 +436,12 @@ bool PSScavenge::invoke_no_policy() {
     // Reset our survivor overflow.
     set_survivor_overflow(false);
 
-    const uint active_workers =
+    const uint active_workers = _worker_efficiency.limit_active_workers(
       WorkerPolicy::calc_active_workers(ParallelScavengeHeap::heap()->workers().max_workers(),
                                         ParallelScavengeHeap::heap()->workers().active_workers(),
-                                        Threads::number_of_non_daemon_threads());
+                                        Threads::number_of_non_daemon_threads()));
     ParallelScavengeHeap::heap()->workers().set_active_workers(active_workers);
+    GCWorkerEfficiencyMark wem(&_worker_efficiency, &ParallelScavengeHeap::heap()->workers());
 
     PSPromotionManager::pre_scavenge();
 
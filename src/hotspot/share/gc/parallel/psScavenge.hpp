@@ -28,6 +28,7 @@
 #include "gc/parallel/psCardTable.hpp"
 #include "gc/parallel/psVirtualspace.hpp"
 #include "gc/shared/collectorCounters.hpp"
+#include "gc/shared/gcWorkerEfficiency.hpp"
 #include "gc/shared/referenceProcessor.hpp"
 #include "gc/shared/gcTrace.hpp"
 #include "memory/allStatic.hpp"
@@ -70,6 +71,7 @@ class PSScavenge: AllStatic {
   // Used to optimize compressed oops young gen boundary checking.
   static uintptr_t            _young_generation_boundary_compressed;
   static CollectorCounters*   _counters;             // collector performance counters
+  static GCWorkerEfficiency   _worker_efficiency;    // worker count limit by CPU efficiency
 
   static void clean_up_failed_promotion();
 
@@ -230,6 +230,10 @@ DefNewGeneration::DefNewGeneration(ReservedSpace rs,
     _preserved_marks_set(false /* in_c_heap */),
     _promo_failure_drain_in_progress(false),
     _should_allocate_from_space(false),
+    _avg_young_pause(AdaptiveTimeWeight),
+    _avg_mutator_time(AdaptiveTimeWeight),
+    _last_young_gc_end(),
+    _desired_young_size(initial_size),
     _string_dedup_requests()
 {
   MemRegion cmr((HeapWord*)_virtual_space.low(),
@@ -422,6 +426,9 @@ void DefNewGeneration::compute_new_size() {
   // will normally be empty.
   // Note that we check both spaces, since if scavenge failed they revert roles.
   // If not we bail out (otherwise we would have to relocate the objects).
+  // Eden sits at the bottom of the young generation with both survivor spaces
+  // directly above it (see compute_space_boundaries()), so even with an empty
+  // eden, moving the eden end would move the survivor holding live objects.
   if (!from()->is_empty() || !to()->is_empty()) {
     return;
   }
@@ -447,6 +454,12 @@ void DefNewGeneration::compute_new_size() {
   size_t desired_new_size = adjust_for_thread_increase(new_size_candidate, new_size_before,
                                                        alignment, thread_increase_size);
 
+  if (SerialAdaptiveYoungSize) {
+    // Follow what the pause, throughput and footprint goals asked for, up
+    // to the young generation reserve, instead of the NewRatio based size.
+    desired_new_size = align_up(_desired_young_size, alignment);
+  }
+
   // Adjust new generation size
   desired_new_size = clamp(desired_new_size, min_new_size, max_new_size);
   assert(desired_new_size <= max_new_size, "just checking");
@@ -491,6 +504,51 @@ void DefNewGeneration::compute_new_size() {
       }
 }
 
+void DefNewGeneration::update_desired_young_size() {
+  const Tickspan pause = _gc_timer->gc_end() - _gc_timer->gc_start();
+  _avg_young_pause.sample((float)pause.seconds());
+  if (_last_young_gc_end.value() != 0) {
+    const Tickspan mutator = _gc_timer->gc_start() - _last_young_gc_end;
+    _avg_mutator_time.sample((float)mutator.seconds());
+  }
+  _last_young_gc_end = _gc_timer->gc_end();
+
+  const double avg_pause = _avg_young_pause.average();
+  const double avg_mutator = _avg_mutator_time.average();
+  const double pause_goal = (double)MaxGCPauseMillis / MILLIUNITS;
+  const double gc_cost = avg_pause / MAX2(avg_pause + avg_mutator, 1.0e-6);
+  const double gc_cost_goal = 1.0 / (1.0 + GCTimeRatio);
+
+  const size_t cur_size = _virtual_space.committed_size();
+  const size_t increment = cur_size / 100 * YoungGenerationSizeIncrement;
+  const size_t decrement = increment / AdaptiveSizeDecrementScaleFactor;
+
+  size_t desired;
+  const char* reason;
+  if (avg_pause > pause_goal) {
+    // Pauses scale with the amount of live data found in eden, so a smaller
+    // eden gives shorter (but more frequent) pauses.
+    desired = cur_size - MIN2(decrement, cur_size);
+    reason = "pause goal";
+  } else if (gc_cost > gc_cost_goal) {
+    // Fewer young GCs for the same allocation rate.
+    desired = cur_size + increment;
+    reason = "throughput goal";
+  } else {
+    // Both goals are met; give back memory slowly.
+    desired = cur_size - MIN2(decrement, cur_size);
+    reason = "footprint goal";
+  }
+  _desired_young_size = clamp(align_up(desired, Generation::GenGrain),
+                              (size_t)NewSize, reserved().byte_size());
+
+  log_debug(gc, ergo, heap)("Adaptive young size: avg pause %.3fms goal %.3fms, "
+                            "gc cost %.4f goal %.4f, " SIZE_FORMAT "K->" SIZE_FORMAT "K (%s)",
+                            avg_pause * MILLIUNITS, pause_goal * MILLIUNITS,
+                            gc_cost, gc_cost_goal,
+                            cur_size / K, _desired_young_size / K, reason);
+}
+
 void DefNewGeneration::ref_processor_init() {
   assert(_ref_processor == nullptr, "a reference processor already exists");
   assert(!_reserved.is_empty(), "empty generation?");
@@ -737,6 +795,10 @@ bool DefNewGeneration::collect(bool clear_all_soft_refs) {
 
   _gc_tracer->report_gc_end(_gc_timer->gc_end(), _gc_timer->time_partitions());
 
+  if (SerialAdaptiveYoungSize && !_promotion_failed) {
+    update_desired_young_size();
+  }
+
   return !_promotion_failed;
 }
 
@@ -30,6 +30,7 @@
 #include "gc/serial/tenuredGeneration.hpp"
 #include "gc/shared/ageTable.hpp"
 #include "gc/shared/copyFailedInfo.hpp"
+#include "gc/shared/gcUtil.hpp"
 #include "gc/shared/gc_globals.hpp"
 #include "gc/shared/generationCounters.hpp"
 #include "gc/shared/preservedMarks.hpp"
@@ -37,6 +38,7 @@
 #include "gc/shared/tlab_globals.hpp"
 #include "utilities/align.hpp"
 #include "utilities/stack.hpp"
+#include "utilities/ticks.hpp"
 
 class ContiguousSpace;
 class CSpaceCounters;
@@ -119,6 +121,17 @@ class DefNewGeneration: public Generation {
   size_t               _max_eden_size;
   size_t               _max_survivor_size;
 
+  // Adaptive sizing support (SerialAdaptiveYoungSize). The desired size is
+  // updated after every young GC, but only applied by compute_new_size()
+  // once the survivor spaces are empty; with MaxTenuringThreshold=0 that is
+  // after every young GC.
+  AdaptiveWeightedAverage _avg_young_pause;
+  AdaptiveWeightedAverage _avg_mutator_time;
+  Ticks                   _last_young_gc_end;
+  size_t                  _desired_young_size;
+
+  void update_desired_young_size();
+
   // Allocation support
   bool _should_allocate_from_space;
   bool should_allocate_from_space() const {
@@ -48,6 +48,7 @@
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/gc_globals.hpp"
+#include "gc/shared/markBitMap.inline.hpp"
 #include "gc/shared/modRefBarrierSet.hpp"
 #include "gc/shared/preservedMarks.inline.hpp"
 #include "gc/shared/referencePolicy.hpp"
@@ -56,7 +57,10 @@
 #include "gc/shared/strongRootsScope.hpp"
 #include "gc/shared/weakProcessor.hpp"
 #include "memory/iterator.inline.hpp"
+#include "memory/memRegion.hpp"
 #include "memory/universe.hpp"
+#include "memory/virtualspace.hpp"
+#include "nmt/memTracker.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/compressedOops.inline.hpp"
 #include "oops/instanceRefKlass.hpp"
@@ -65,6 +69,8 @@
 #include "oops/objArrayKlass.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/typeArrayOop.inline.hpp"
+#include "runtime/java.hpp"
+#include "runtime/os.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "utilities/align.hpp"
 #include "utilities/copy.hpp"
@@ -81,6 +87,8 @@ PreservedMarksSet       SerialFullGC::_preserved_overflow_stack_set(false /* in_
 size_t                  SerialFullGC::_preserved_count = 0;
 size_t                  SerialFullGC::_preserved_count_max = 0;
 PreservedMark*          SerialFullGC::_preserved_marks = nullptr;
+MarkBitMap              SerialFullGC::_mark_bitmap;
+MemRegion               SerialFullGC::_mark_bitmap_storage;
 STWGCTimer*             SerialFullGC::_gc_timer        = nullptr;
 SerialOldTracer*        SerialFullGC::_gc_tracer       = nullptr;
 
@@ -95,6 +103,13 @@ MarkAndPushClosure SerialFullGC::mark_and_push_closure(ClassLoaderData::_claim_s
 CLDToOopClosure    SerialFullGC::follow_cld_closure(&mark_and_push_closure, ClassLoaderData::_claim_stw_fullgc_mark);
 CLDToOopClosure    SerialFullGC::adjust_cld_closure(&adjust_pointer_closure, ClassLoaderData::_claim_stw_fullgc_adjust);
 
+inline bool SerialFullGC::is_marked(oop obj) {
+  if (SerialFullGCUseMarkBitmap) {
+    return _mark_bitmap.is_marked(obj);
+  }
+  return obj->is_gc_marked();
+}
+
 class DeadSpacer : StackObj {
   size_t _allowed_deadspace_words;
   bool _active;
@@ -230,8 +245,16 @@ class Compacter {
   static void forward_obj(oop obj, HeapWord* new_addr) {
     prefetch_write_scan(obj);
     if (cast_from_oop<HeapWord*>(obj) != new_addr) {
+      if (SerialFullGCUseMarkBitmap) {
+        // Marking left the mark word intact; the forwarding pointer is
+        // about to overwrite it.
+        markWord mark = obj->mark();
+        if (obj->mark_must_be_preserved(mark)) {
+          SerialFullGC::preserve_mark(obj, mark);
+        }
+      }
       obj->forward_to(cast_to_oop(new_addr));
-    } else {
+    } else if (!SerialFullGCUseMarkBitmap) {
       assert(obj->is_gc_marked(), "inv");
       // This obj will stay in-place. Fix the markword.
       obj->init_mark();
@@ -239,6 +262,9 @@ class Compacter {
   }
 
   static HeapWord* find_next_live_addr(HeapWord* start, HeapWord* end) {
+    if (SerialFullGCUseMarkBitmap) {
+      return SerialFullGC::mark_bitmap()->get_next_marked_addr(start, end);
+    }
     for (HeapWord* i_addr = start; i_addr < end; /* empty */) {
       prefetch_read_scan(i_addr);
       oop obj = cast_to_oop(i_addr);
@@ -298,7 +324,7 @@ class Compacter {
       while (cur_addr < top) {
         oop obj = cast_to_oop(cur_addr);
         size_t obj_size = obj->size();
-        if (obj->is_gc_marked()) {
+        if (SerialFullGC::is_marked(obj)) {
           HeapWord* new_addr = alloc(obj_size);
           forward_obj(obj, new_addr);
           cur_addr += obj_size;
@@ -334,7 +360,7 @@ class Compacter {
 
       while (cur_addr < top) {
         prefetch_write_scan(cur_addr);
-        if (cur_addr < first_dead || cast_to_oop(cur_addr)->is_gc_marked()) {
+        if (cur_addr < first_dead || SerialFullGC::is_marked(cast_to_oop(cur_addr))) {
           size_t size = cast_to_oop(cur_addr)->oop_iterate_size(&SerialFullGC::adjust_pointer_closure);
           cur_addr += size;
         } else {
@@ -394,7 +420,7 @@ void SerialFullGC::follow_array(objArrayOop array) {
 }
 
 void SerialFullGC::follow_object(oop obj) {
-  assert(obj->is_gc_marked(), "should be marked");
+  assert(is_marked(obj), "should be marked");
   if (obj->is_objArray()) {
     // Handle object arrays explicitly to allow them to
     // be split into chunks if needed.
@@ -423,7 +449,7 @@ void SerialFullGC::follow_stack() {
   do {
     while (!_marking_stack.is_empty()) {
       oop obj = _marking_stack.pop();
-      assert (obj->is_gc_marked(), "p must be marked");
+      assert(is_marked(obj), "p must be marked");
       follow_object(obj);
     }
     // Process ObjArrays one at a time to avoid marking stack bloat.
@@ -444,7 +470,7 @@ template <class T> void SerialFullGC::follow_root(T* p) {
   T heap_oop = RawAccess<>::oop_load(p);
   if (!CompressedOops::is_null(heap_oop)) {
     oop obj = CompressedOops::decode_not_null(heap_oop);
-    if (!obj->mark().is_marked()) {
+    if (!is_marked(obj)) {
       mark_object(obj);
       follow_object(obj);
     }
@@ -583,6 +609,38 @@ void SerialFullGC::deallocate_stacks() {
   _objarray_stack.clear(true);
 }
 
+void SerialFullGC::initialize_mark_bitmap() {
+  SerialHeap* gch = SerialHeap::heap();
+  // The young generation is reserved right below the old generation.
+  MemRegion heap(gch->young_gen()->reserved().start(), gch->old_gen()->reserved().end());
+  size_t bitmap_size = MarkBitMap::compute_size(heap.byte_size());
+
+  ReservedSpace bitmap(bitmap_size);
+  if (!bitmap.is_reserved()) {
+    vm_exit_during_initialization("Could not reserve space for serial full GC mark bitmap");
+  }
+  MemTracker::record_virtual_memory_type(bitmap.base(), mtGC);
+
+  _mark_bitmap_storage = MemRegion((HeapWord*)bitmap.base(), bitmap.size() / HeapWordSize);
+  _mark_bitmap.initialize(heap, _mark_bitmap_storage);
+}
+
+void SerialFullGC::commit_mark_bitmap() {
+  // Freshly committed memory is zeroed, so the bitmap starts out clear.
+  os::commit_memory_or_exit((char*)_mark_bitmap_storage.start(),
+                            _mark_bitmap_storage.byte_size(),
+                            false, "Cannot commit serial full GC mark bitmap");
+}
+
+void SerialFullGC::uncommit_mark_bitmap() {
+  if (!os::uncommit_memory((char*)_mark_bitmap_storage.start(),
+                           _mark_bitmap_storage.byte_size())) {
+    // Keep the bitmap committed, but it must be clear for the next full GC.
+    log_warning(gc)("Could not uncommit serial full GC mark bitmap");
+    _mark_bitmap.clear();
+  }
+}
+
 void SerialFullGC::mark_object(oop obj) {
   if (StringDedup::is_enabled() &&
       java_lang_String::is_instance(obj) &&
@@ -590,6 +648,14 @@ void SerialFullGC::mark_object(oop obj) {
     _string_dedup_requests->add(obj);
   }
 
+  if (SerialFullGCUseMarkBitmap) {
+    // The mark word is left alone; objects that move have theirs preserved
+    // when they get forwarded.
+    _mark_bitmap.mark(obj);
+    ContinuationGCSupport::transform_stack_chunk(obj);
+    return;
+  }
+
   // some marks may contain information we need to preserve so we store them away
   // and overwrite the mark.  We'll restore it at the end of serial full GC.
   markWord mark = obj->mark();
@@ -606,7 +672,7 @@ template <class T> void SerialFullGC::mark_and_push(T* p) {
   T heap_oop = RawAccess<>::oop_load(p);
   if (!CompressedOops::is_null(heap_oop)) {
     oop obj = CompressedOops::decode_not_null(heap_oop);
-    if (!obj->mark().is_marked()) {
+    if (!is_marked(obj)) {
       mark_object(obj);
       _marking_stack.push(obj);
     }
@@ -663,7 +729,7 @@ void SerialFullGC::restore_marks() {
 
 SerialFullGC::IsAliveClosure   SerialFullGC::is_alive;
 
-bool SerialFullGC::IsAliveClosure::do_object_b(oop p) { return p->is_gc_marked(); }
+bool SerialFullGC::IsAliveClosure::do_object_b(oop p) { return is_marked(p); }
 
 SerialFullGC::KeepAliveClosure SerialFullGC::keep_alive;
 
@@ -676,9 +742,17 @@ void SerialFullGC::initialize() {
   SerialFullGC::_string_dedup_requests = new StringDedup::Requests();
 
   // The Full GC operates on the entire heap so all objects should be subject
-  // to discovery, hence the _always_true_closure.
-  SerialFullGC::_ref_processor = new ReferenceProcessor(&_always_true_closure);
+  // to discovery, hence the _always_true_closure. With the side mark bitmap
+  // the mark word of a marked referent is left alone, so discovery has to
+  // look up the bitmap to skip references whose referents are already marked.
+  SerialFullGC::_ref_processor = new ReferenceProcessor(&_always_true_closure,
+                                                        1, 1, false,
+                                                        SerialFullGCUseMarkBitmap ? &is_alive : nullptr);
   mark_and_push_closure.set_ref_discoverer(_ref_processor);
+
+  if (SerialFullGCUseMarkBitmap) {
+    initialize_mark_bitmap();
+  }
 }
 
 void SerialFullGC::invoke_at_safepoint(bool clear_all_softrefs) {
@@ -694,6 +768,10 @@ void SerialFullGC::invoke_at_safepoint(bool clear_all_softrefs) {
 
   allocate_stacks();
 
+  if (SerialFullGCUseMarkBitmap) {
+    commit_mark_bitmap();
+  }
+
   phase1_mark(clear_all_softrefs);
 
   Compacter compacter{gch};
@@ -741,6 +819,10 @@ void SerialFullGC::invoke_at_safepoint(bool clear_all_softrefs) {
 
   deallocate_stacks();
 
+  if (SerialFullGCUseMarkBitmap) {
+    uncommit_mark_bitmap();
+  }
+
   SerialFullGC::_string_dedup_requests->flush();
 
   bool is_young_gen_empty = (gch->young_gen()->used() == 0);
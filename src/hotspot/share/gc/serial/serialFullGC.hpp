@@ -26,6 +26,7 @@
 #define SHARE_GC_SERIAL_SERIALFULLGC_HPP
 
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/markBitMap.hpp"
 #include "gc/shared/preservedMarks.hpp"
 #include "gc/shared/referenceProcessor.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
@@ -91,6 +92,11 @@ class SerialFullGC : AllStatic {
   static size_t                          _preserved_count_max;
   static PreservedMark*                  _preserved_marks;
 
+  // Side mark bitmap, only used with SerialFullGCUseMarkBitmap. The backing
+  // storage is reserved up front, but only committed during a full GC.
+  static MarkBitMap                      _mark_bitmap;
+  static MemRegion                       _mark_bitmap_storage;
+
   static AlwaysTrueClosure               _always_true_closure;
   static ReferenceProcessor*             _ref_processor;
 
@@ -122,6 +128,9 @@ class SerialFullGC : AllStatic {
   static STWGCTimer* gc_timer() { return _gc_timer; }
   static SerialOldTracer* gc_tracer() { return _gc_tracer; }
 
+  static inline bool is_marked(oop obj);
+  static MarkBitMap* mark_bitmap() { return &_mark_bitmap; }
+
   static void preserve_mark(oop p, markWord mark);
                                 // Save the mark word so it can be restored later
   static void adjust_marks();   // Adjust the pointers in the preserved marks table
@@ -142,6 +151,10 @@ class SerialFullGC : AllStatic {
   static void allocate_stacks();
   static void deallocate_stacks();
 
+  static void initialize_mark_bitmap();
+  static void commit_mark_bitmap();
+  static void uncommit_mark_bitmap();
+
   // Call backs for marking
   static void mark_object(oop obj);
   // Mark pointer and follow contents.  Empty marking stack afterwards.
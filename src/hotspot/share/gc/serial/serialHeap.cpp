@@ -478,6 +478,11 @@ bool SerialHeap::do_young_collection(bool clear_soft_refs) {
   }
 
   _young_gen->compute_new_size();
+  if (SerialAdaptiveYoungSize && result) {
+    // Give back old generation space that promotion no longer needs,
+    // rather than waiting for the next full GC.
+    _old_gen->compute_new_size();
+  }
 
   print_heap_change(pre_gc_values);
 
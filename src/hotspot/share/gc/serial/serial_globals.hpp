@@ -35,6 +35,15 @@
           "When disabled, informs the GC to shrink the java heap directly"  \
           " to the target size at the next full GC rather than requiring"   \
           " smaller steps during multiple full GCs.")                       \
+                                                                            \
+  product(bool, SerialFullGCUseMarkBitmap, false, EXPERIMENTAL,             \
+          "Record liveness in a side mark bitmap during serial full GC, so" \
+          " mark words only need preserving for objects that move.")        \
+                                                                            \
+  product(bool, SerialAdaptiveYoungSize, false, EXPERIMENTAL,               \
+          "Resize the young generation after young GCs to meet "            \
+          "MaxGCPauseMillis and GCTimeRatio with the smallest footprint, "  \
+          "and resize the old generation after young GCs as well")          \
 
 // end of GC_SERIAL_FLAGS
 
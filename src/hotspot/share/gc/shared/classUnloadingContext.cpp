@@ -25,8 +25,10 @@
 #include "precompiled.hpp"
 
 #include "classfile/classLoaderData.inline.hpp"
+#include "code/codeCache.hpp"
 #include "code/nmethod.hpp"
 #include "gc/shared/classUnloadingContext.hpp"
+#include "logging/log.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "utilities/growableArray.hpp"
 
@@ -111,15 +113,20 @@ void ClassUnloadingContext::purge_nmethods() {
   assert(_context != nullptr, "no context set");
 
   size_t freed_memory = 0;
+  uint purged_nmethods = 0;
 
   for (uint i = 0; i < _num_nmethod_unlink_workers; ++i) {
     NMethodSet* set = _unlinked_nmethods[i];
     for (nmethod* nm : *set) {
       freed_memory += nm->size();
+      purged_nmethods++;
       nm->purge(_unregister_nmethods_during_purge);
     }
   }
 
+  log_debug(codecache)("Purged %u unlinked nmethods, freed " SIZE_FORMAT "K",
+                       purged_nmethods, freed_memory / K);
+
   CodeCache::maybe_restart_compiler(freed_memory);
 }
 
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/concurrentPretouchThread.hpp"
+#include "gc/shared/pretouchTask.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
+#include "logging/log.hpp"
+#include "memory/universe.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
+#include "utilities/ticks.hpp"
+
+ConcurrentPretouchThread::ConcurrentPretouchThread() :
+    ConcurrentGCThread(),
+    _num_ranges(0),
+    _started(false) {
+  set_name("Pretouch Thread");
+}
+
+bool ConcurrentPretouchThread::add_range(MemRegion range, size_t page_size) {
+  assert(!_started, "ranges must be added before starting");
+  if (range.is_empty()) {
+    return true;
+  }
+  for (uint i = 0; i < _num_ranges; i++) {
+    if (_page_sizes[i] == page_size &&
+        (_ranges[i].end() == range.start() || range.end() == _ranges[i].start())) {
+      _ranges[i] = _ranges[i]._union(range);
+      return true;
+    }
+  }
+  if (_num_ranges == MaxRanges) {
+    return false;
+  }
+  _ranges[_num_ranges] = range;
+  _page_sizes[_num_ranges] = page_size;
+  _num_ranges++;
+  return true;
+}
+
+void ConcurrentPretouchThread::start() {
+  assert(!_started, "already started");
+  _started = true;
+  create_and_start(NormPriority);
+}
+
+void ConcurrentPretouchThread::pretouch_range(MemRegion range, size_t page_size) {
+  const size_t chunk_size = align_up(PretouchTask::chunk_size(), page_size);
+  CollectedHeap* heap = Universe::heap();
+
+  char* const bottom = (char*)range.start();
+  char* cur_end = (char*)range.end();
+  while (cur_end > bottom && !should_terminate()) {
+    char* cur_start = cur_end - MIN2(chunk_size, pointer_delta(cur_end, bottom, 1));
+
+    SuspendibleThreadSetJoiner sts_joiner;
+    // Only touch memory that is still committed. The committed part of
+    // a space is contiguous, so checking both ends of the chunk suffices.
+    if (heap->is_in(cur_start) && heap->is_in(cur_end - 1)) {
+      os::pretouch_memory(cur_start, cur_end, page_size);
+    }
+    cur_end = cur_start;
+  }
+}
+
+void ConcurrentPretouchThread::run_service() {
+  Ticks start = Ticks::now();
+  size_t total_bytes = 0;
+  for (uint i = 0; i < _num_ranges && !should_terminate(); i++) {
+    pretouch_range(_ranges[i], _page_sizes[i]);
+    total_bytes += _ranges[i].byte_size();
+  }
+  log_info(gc, init)("Concurrent pre-touch of " SIZE_FORMAT "M finished in %.3fms",
+                     total_bytes / M, (Ticks::now() - start).seconds() * MILLIUNITS);
+}
+
+void ConcurrentPretouchThread::stop_service() {
+  // Nothing to do, pretouch_range() checks should_terminate() per chunk.
+}
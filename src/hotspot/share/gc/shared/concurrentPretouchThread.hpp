@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHARED_CONCURRENTPRETOUCHTHREAD_HPP
+#define SHARE_GC_SHARED_CONCURRENTPRETOUCHTHREAD_HPP
+
+#include "gc/shared/concurrentGCThread.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "memory/memRegion.hpp"
+
+// Pre-touches the initially committed heap in the background, so that
+// startup with AlwaysPreTouch does not wait until every page of a large
+// heap has been touched.
+//
+// Ranges are registered during heap initialization and processed in
+// registration order, each from its end downwards, since allocation
+// proceeds upwards from the bottom of a space. Mutators that get ahead of
+// the pre-touch frontier simply fault in the pages themselves.
+//
+// Every chunk is touched while joined to the suspendible thread set, so
+// the heap must synchronize the set at safepoints while this thread is
+// running. A chunk is skipped if the heap no longer has it committed, e.g.
+// because a GC shrank the generation in the meantime.
+class ConcurrentPretouchThread : public ConcurrentGCThread {
+  static const uint MaxRanges = 8;
+
+  MemRegion _ranges[MaxRanges];
+  size_t    _page_sizes[MaxRanges];
+  uint      _num_ranges;
+  bool      _started;
+
+  void pretouch_range(MemRegion range, size_t page_size);
+
+protected:
+  virtual void run_service();
+  virtual void stop_service();
+
+public:
+  ConcurrentPretouchThread();
+
+  static bool is_enabled() { return AlwaysPreTouch && ConcurrentPreTouch; }
+
+  // Register a range to be pre-touched. Only valid before start(). A range
+  // adjacent to an already registered one is merged with it. Returns false
+  // if there is no room left for the range, in which case the caller must
+  // pre-touch it itself.
+  bool add_range(MemRegion range, size_t page_size);
+
+  bool is_started() const { return _started; }
+  void start();
+};
+
+#endif // SHARE_GC_SHARED_CONCURRENTPRETOUCHTHREAD_HPP
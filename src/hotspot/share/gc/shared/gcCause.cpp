@@ -126,6 +126,9 @@ const char* GCCause::to_string(GCCause::Cause cause) {
     case _z_high_usage:
       return "High Usage";
 
+    case _z_memory_pressure:
+      return "Memory Pressure";
+
     case _last_gc_cause:
       return "ILLEGAL VALUE - last gc cause - ILLEGAL VALUE";
 
@@ -86,6 +86,7 @@ class GCCause : public AllStatic {
     _z_allocation_stall,
     _z_proactive,
     _z_high_usage,
+    _z_memory_pressure,
 
     _last_gc_cause
   };
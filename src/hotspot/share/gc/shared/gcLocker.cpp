@@ -33,6 +33,7 @@
 #include "runtime/javaThread.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/threadSMR.hpp"
+#include "utilities/ticks.hpp"
 
 volatile jint GCLocker::_jni_lock_count = 0;
 volatile bool GCLocker::_needs_gc       = false;
@@ -110,11 +111,18 @@ void GCLocker::stall_until_clear() {
   if (needs_gc()) {
     GCLockerTracer::inc_stall_count();
     log_debug_jni("Allocation failed. Thread stalled by JNI critical section.");
-  }
 
-  // Wait for _needs_gc  to be cleared
-  while (needs_gc()) {
-    ml.wait();
+    // Wait for _needs_gc  to be cleared
+    Ticks start = Ticks::now();
+    while (needs_gc()) {
+      ml.wait();
+    }
+    Log(gc, jni) log;
+    if (log.is_debug()) {
+      ResourceMark rm; // JavaThread::name() allocates to convert to UTF8
+      log.debug("Thread \"%s\" stalled by JNI critical section for %.3fms.",
+                Thread::current()->name(), (Ticks::now() - start).seconds() * MILLIUNITS);
+    }
   }
 }
 
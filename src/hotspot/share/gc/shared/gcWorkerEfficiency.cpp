@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "gc/shared/gcWorkerEfficiency.hpp"
+#include "gc/shared/workerThread.hpp"
+#include "logging/log.hpp"
+#include "memory/iterator.hpp"
+#include "runtime/os.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+GCWorkerEfficiency::GCWorkerEfficiency() :
+  _avg_efficiency(EfficiencyWeight, 1.0f),
+  _worker_limit(UINT_MAX) {}
+
+bool GCWorkerEfficiency::is_enabled() {
+  return (GCWorkerEfficiencyTargetPercent > 0) && os::is_thread_cpu_time_supported();
+}
+
+class GCWorkerCPUTimeClosure : public ThreadClosure {
+  jlong _total;
+
+public:
+  GCWorkerCPUTimeClosure() : _total(0) {}
+
+  void do_thread(Thread* thread) override {
+    jlong cpu_time = os::thread_cpu_time(thread);
+    if (cpu_time > 0) {
+      _total += cpu_time;
+    }
+  }
+
+  jlong total() const { return _total; }
+};
+
+jlong GCWorkerEfficiency::worker_cpu_time(const WorkerThreads* workers) {
+  GCWorkerCPUTimeClosure cl;
+  workers->threads_do(&cl);
+  return cl.total();
+}
+
+uint GCWorkerEfficiency::limit_active_workers(uint active_workers) const {
+  if (!is_enabled()) {
+    return active_workers;
+  }
+  return MAX2(MIN2(active_workers, _worker_limit), 1u);
+}
+
+void GCWorkerEfficiency::record(uint active_workers, jlong worker_cpu_time, jlong task_worker_time) {
+  assert(is_enabled(), "precondition");
+  if ((active_workers == 0) || (task_worker_time <= 0)) {
+    return;
+  }
+  float efficiency = (float)MIN2((double)worker_cpu_time / task_worker_time, 1.0);
+  _avg_efficiency.sample(efficiency);
+
+  float target = GCWorkerEfficiencyTargetPercent / 100.0f;
+  float average = _avg_efficiency.average();
+  uint old_limit = _worker_limit;
+  if (average < target) {
+    // Shrink in proportion to the shortfall, but by at most half at a time.
+    uint scaled = (uint)(active_workers * (average / target));
+    _worker_limit = MAX3(scaled, active_workers / 2, 1u);
+  } else if (active_workers < UINT_MAX) {
+    _worker_limit = active_workers + 1;
+  }
+
+  log_debug(gc, task)("GC worker efficiency: %.1f%% (average %.1f%%) with %u workers, "
+                      "worker limit: %u -> %u",
+                      efficiency * 100.0, average * 100.0, active_workers,
+                      old_limit, _worker_limit);
+}
+
+GCWorkerEfficiencyMark::GCWorkerEfficiencyMark(GCWorkerEfficiency* efficiency,
+                                               const WorkerThreads* workers) :
+  _efficiency(GCWorkerEfficiency::is_enabled() ? efficiency : nullptr),
+  _workers(workers),
+  _start_task_time(0),
+  _start_cpu_time(0) {
+  if (_efficiency != nullptr) {
+    _start_task_time = _workers->task_worker_time_ns();
+    _start_cpu_time = GCWorkerEfficiency::worker_cpu_time(_workers);
+  }
+}
+
+GCWorkerEfficiencyMark::~GCWorkerEfficiencyMark() {
+  if (_efficiency != nullptr) {
+    jlong task_time = _workers->task_worker_time_ns() - _start_task_time;
+    jlong cpu_time = GCWorkerEfficiency::worker_cpu_time(_workers) - _start_cpu_time;
+    _efficiency->record(_workers->active_workers(), cpu_time, task_time);
+  }
+}
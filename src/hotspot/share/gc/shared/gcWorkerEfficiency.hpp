@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHARED_GCWORKEREFFICIENCY_HPP
+#define SHARE_GC_SHARED_GCWORKEREFFICIENCY_HPP
+
+#include "gc/shared/gcUtil.hpp"
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class WorkerThreads;
+
+// Tracks how efficiently the workers of a kind of pause use the CPU, and
+// limits the number of active workers of the next pause of that kind
+// accordingly.
+//
+// The efficiency of a pause is the CPU time used by the workers divided
+// by the worker time available to the parallel tasks of the pause, i.e.
+// the wall time of each WorkerThreads::run_task times its number of active
+// workers.  Serial phases of the pause are not counted.  If the workers
+// are oversubscribed, e.g. because the container has less CPU quota than
+// it has processors, they spend much of the pause descheduled, and the
+// efficiency is low.  Fewer workers then do the same work with less
+// contention.  While the efficiency is at or above the target
+// (GCWorkerEfficiencyTargetPercent), the limit is raised one worker at a
+// time.
+class GCWorkerEfficiency : public CHeapObj<mtGC> {
+  // Weight of the most recent pause in the average.  Not AdaptiveTimeWeight,
+  // as instances may be constructed before flags are processed.
+  static const unsigned EfficiencyWeight = 35;
+
+  AdaptiveWeightedAverage _avg_efficiency;
+  uint _worker_limit;
+
+public:
+  GCWorkerEfficiency();
+
+  static bool is_enabled();
+
+  // Returns the CPU time in nanoseconds used by the workers so far.
+  static jlong worker_cpu_time(const WorkerThreads* workers);
+
+  // Returns active_workers, limited by the recorded efficiency.
+  uint limit_active_workers(uint active_workers) const;
+
+  // Record a pause that used active_workers workers, whose parallel tasks
+  // had task_worker_time nanoseconds of worker time available, during which
+  // the workers used worker_cpu_time nanoseconds of CPU time.
+  void record(uint active_workers, jlong worker_cpu_time, jlong task_worker_time);
+};
+
+// Scoped recording of the efficiency of a pause.  The workers must have
+// their number of active workers set up before this is constructed.
+class GCWorkerEfficiencyMark : public StackObj {
+  GCWorkerEfficiency* _efficiency;
+  const WorkerThreads* _workers;
+  jlong _start_task_time;
+  jlong _start_cpu_time;
+
+public:
+  GCWorkerEfficiencyMark(GCWorkerEfficiency* efficiency, const WorkerThreads* workers);
+  ~GCWorkerEfficiencyMark();
+};
+
+#endif // SHARE_GC_SHARED_GCWORKEREFFICIENCY_HPP
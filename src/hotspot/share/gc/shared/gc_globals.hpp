@@ -139,6 +139,13 @@
              "Inject thread creation failures for "                         \
              "UseDynamicNumberOfGCThreads")                                 \
                                                                             \
+  product(uint, GCWorkerEfficiencyTargetPercent, 0, EXPERIMENTAL,           \
+          "If non-zero, limit the number of active workers of the next "    \
+          "pause of the same kind if the CPU time used by the workers "     \
+          "was below this percentage of the number of active workers "      \
+          "times the pause time. Zero disables the limit.")                 \
+          range(0, 100)                                                     \
+                                                                            \
   product(size_t, HeapSizePerGCThread, ScaleForWordSize(32*M),              \
           "Size of heap (bytes) per GC thread used in calculating the "     \
           "number of GC threads")                                           \
@@ -192,6 +199,11 @@
   product(bool, AlwaysPreTouchStacks, false, DIAGNOSTIC,                    \
           "Force java thread stacks to be fully pre-touched")               \
                                                                             \
+  product(bool, ConcurrentPreTouch, false, EXPERIMENTAL,                    \
+          "With AlwaysPreTouch, pre-touch the initial heap in a background "\
+          "thread instead of during heap initialization. Only supported "   \
+          "by ParallelGC.")                                                 \
+                                                                            \
   product_pd(size_t, PreTouchParallelChunkSize,                             \
           "Per-thread chunk size for parallel memory pre-touch.")           \
           range(4*K, SIZE_MAX / 2)                                          \
@@ -1089,6 +1089,13 @@ bool OopStorage::BasicParState::claim_next_segment(IterationData* data) {
   // threads to do.  But too small a step can lead to contention
   // over _next_block, esp. when the work per block is small.
   size_t max_step = 10;
+  // The work per block is roughly proportional to the number of allocated
+  // entries.  If the blocks processed so far were sparsely populated, as is
+  // common for e.g. weak storages, claim more of them at a time.
+  if (data->_processed > 0) {
+    size_t avg_entries = MAX2(data->_entries / data->_processed, size_t(1));
+    max_step *= MIN2(BitsPerWord / avg_entries, size_t(8));
+  }
   size_t remaining = _block_count - start;
   size_t step = MIN2(max_step, 1 + (remaining / _estimated_thread_count));
   // Atomic::add with possible overshoot.  This can perform better
@@ -1115,9 +1122,9 @@ bool OopStorage::BasicParState::claim_next_segment(IterationData* data) {
 bool OopStorage::BasicParState::finish_iteration(const IterationData* data) const {
   log_info(oopstorage, blocks, stats)
           ("Parallel iteration on %s: blocks = " SIZE_FORMAT
-           ", processed = " SIZE_FORMAT " (%2.f%%)",
+           ", processed = " SIZE_FORMAT " (%2.f%%), entries = " SIZE_FORMAT,
            _storage->name(), _block_count, data->_processed,
-           percent_of(data->_processed, _block_count));
+           percent_of(data->_processed, _block_count), data->_entries);
   return false;
 }
 
@@ -29,6 +29,7 @@
 
 #include "memory/allocation.hpp"
 #include "oops/oop.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "utilities/align.hpp"
 #include "utilities/count_trailing_zeros.hpp"
@@ -173,6 +174,9 @@ class OopStorage::Block /* No base class, to avoid messing up alignment. */ {
   bool is_empty() const;
   uintx allocated_bitmask() const;
 
+  // Prefetch the allocation bitmask, ahead of iterating over the block.
+  void prefetch_bitmask() const;
+
   bool is_safe_to_delete() const;
 
   Block* deferred_updates_next() const;
@@ -321,6 +325,10 @@ inline uintx OopStorage::Block::allocated_bitmask() const {
   return _allocated_bitmask;
 }
 
+inline void OopStorage::Block::prefetch_bitmask() const {
+  Prefetch::read(const_cast<uintx*>(&_allocated_bitmask), 0);
+}
+
 inline uintx OopStorage::Block::bitmask_for_index(unsigned index) const {
   check_index(index);
   return uintx(1) << index;
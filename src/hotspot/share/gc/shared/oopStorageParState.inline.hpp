@@ -28,7 +28,9 @@
 #include "gc/shared/oopStorageParState.hpp"
 
 #include "gc/shared/oopStorage.inline.hpp"
+#include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/population_count.hpp"
 
 #include <type_traits>
 
@@ -47,6 +49,7 @@ struct OopStorage::BasicParState::IterationData {
   size_t _segment_start;
   size_t _segment_end;
   size_t _processed;
+  size_t _entries;              // Allocated entries in processed blocks.
 };
 
 template<bool is_const, typename F>
@@ -59,9 +62,19 @@ inline void OopStorage::BasicParState::iterate(F f) {
     assert(data._segment_end <= _block_count, "invariant");
     using BlockPtr = std::conditional_t<is_const, const Block*, Block*>;
     size_t i = data._segment_start;
+    BlockPtr block = _active_array->at(i);
     do {
-      BlockPtr block = _active_array->at(i);
-      block->iterate(atf_f);
+      // Start fetching the next block while working on this one.
+      BlockPtr next = (i + 1 < data._segment_end) ? _active_array->at(i + 1) : nullptr;
+      if (next != nullptr) {
+        next->prefetch_bitmask();
+      }
+      uintx bitmask = block->allocated_bitmask();
+      if (bitmask != 0) {
+        data._entries += population_count(bitmask);
+        block->iterate(atf_f);
+      }
+      block = next;
     } while (++i < data._segment_end);
   }
 }
@@ -71,7 +71,8 @@ SATBMarkQueueSet::SATBMarkQueueSet(BufferNode::Allocator* allocator) :
   _count_and_process_flag(0),
   _process_completed_buffers_threshold(SIZE_MAX),
   _buffer_enqueue_threshold(0),
-  _all_active(false)
+  _all_active(false),
+  _filter_before_enqueue(true)
 {}
 
 SATBMarkQueueSet::~SATBMarkQueueSet() {
@@ -236,6 +237,10 @@ void SATBMarkQueueSet::handle_zero_index(SATBMarkQueue& queue) {
   assert(queue.index() == 0, "precondition");
   if (queue.buffer() == nullptr) {
     install_new_buffer(queue);
+  } else if (!_filter_before_enqueue) {
+    // Leave the filtering to the GC thread that processes the buffer,
+    // rather than delaying the mutator.
+    enqueue_completed_buffer(exchange_buffer_with_new(queue));
   } else {
     filter(queue);
     if (should_enqueue_buffer(queue)) {
@@ -93,6 +93,9 @@ class SATBMarkQueueSet: public PtrQueueSet {
   size_t _buffer_enqueue_threshold;
   // SATB is only active during marking.  Enqueuing is only done when active.
   bool _all_active;
+  // Whether a mutator filters its full buffer before deciding whether to
+  // enqueue it.  If false, full buffers are always enqueued unfiltered.
+  bool _filter_before_enqueue;
   DEFINE_PAD_MINUS_SIZE(2, DEFAULT_PADDING_SIZE, 4 * sizeof(size_t));
 
   BufferNode* get_completed_buffer();
@@ -132,6 +135,9 @@ class SATBMarkQueueSet: public PtrQueueSet {
   size_t buffer_enqueue_threshold() const { return _buffer_enqueue_threshold; }
   void set_buffer_enqueue_threshold_percentage(uint value);
 
+  bool filter_before_enqueue() const { return _filter_before_enqueue; }
+  void set_filter_before_enqueue(bool value) { _filter_before_enqueue = value; }
+
   // If there exists some completed buffer, pop and process it, and
   // return true.  Otherwise return false.  Processing a buffer
   // consists of applying the closure to the active range of the
@@ -117,10 +117,17 @@ void StringDedup::Processor::cleanup_table(bool grow_only, bool force) const {
   }
 }
 
+// Requests are processed in batches of Table::deduplicate_batch_size, so
+// the table lookups for the strings in a batch can be overlapped.  The
+// request references are collected, and the strings are only loaded from
+// them when a batch is processed, with no safepoint checks between loading
+// the strings and deduplicating them.
 class StringDedup::Processor::ProcessRequest final : public OopClosure {
   OopStorage* _storage;
   size_t _release_index;
+  size_t _batch_index;
   oop* _bulk_release[OopStorage::bulk_allocate_limit];
+  oop* _batch[Table::deduplicate_batch_size];
 
   void release_ref(oop* ref) {
     assert(_release_index < ARRAY_SIZE(_bulk_release), "invariant");
@@ -136,35 +143,52 @@ class StringDedup::Processor::ProcessRequest final : public OopClosure {
   ProcessRequest(OopStorage* storage) :
     _storage(storage),
     _release_index(0),
-    _bulk_release()
+    _batch_index(0),
+    _bulk_release(),
+    _batch()
   {}
 
   ~ProcessRequest() {
+    assert(_batch_index == 0, "unprocessed requests");
     _storage->release(_bulk_release, _release_index);
   }
 
   virtual void do_oop(narrowOop*) { ShouldNotReachHere(); }
 
   virtual void do_oop(oop* ref) {
+    _batch[_batch_index++] = ref;
+    if (_batch_index == ARRAY_SIZE(_batch)) {
+      process_batch();
+    }
+  }
+
+  void process_batch() {
     _processor->yield();
-    oop java_string = NativeAccess<ON_PHANTOM_OOP_REF>::oop_load(ref);
-    release_ref(ref);
-    // Dedup java_string, after checking for various reasons to skip it.
-    if (java_string == nullptr) {
-      // String became unreachable before we got a chance to process it.
-      _cur_stat.inc_skipped_dead();
-    } else if (java_lang_String::value(java_string) == nullptr) {
-      // Request during String construction, before its value array has
-      // been initialized.
-      _cur_stat.inc_skipped_incomplete();
-    } else {
-      Table::deduplicate(java_string);
-      if (Table::is_grow_needed()) {
-        _cur_stat.report_process_pause();
-        _processor->cleanup_table(true /* grow_only */, false /* force */);
-        _cur_stat.report_process_resume();
+    oop java_strings[ARRAY_SIZE(_batch)];
+    size_t count = 0;
+    for (size_t i = 0; i < _batch_index; ++i) {
+      oop* ref = _batch[i];
+      oop java_string = NativeAccess<ON_PHANTOM_OOP_REF>::oop_load(ref);
+      release_ref(ref);
+      // Dedup java_string, after checking for various reasons to skip it.
+      if (java_string == nullptr) {
+        // String became unreachable before we got a chance to process it.
+        _cur_stat.inc_skipped_dead();
+      } else if (java_lang_String::value(java_string) == nullptr) {
+        // Request during String construction, before its value array has
+        // been initialized.
+        _cur_stat.inc_skipped_incomplete();
+      } else {
+        java_strings[count++] = java_string;
       }
     }
+    _batch_index = 0;
+    Table::deduplicate(java_strings, count);
+    if (Table::is_grow_needed()) {
+      _cur_stat.report_process_pause();
+      _processor->cleanup_table(true /* grow_only */, false /* force */);
+      _cur_stat.report_process_resume();
+    }
   }
 };
 
@@ -173,6 +197,7 @@ void StringDedup::Processor::process_requests() const {
   OopStorage::ParState<true, false> par_state{_storage_for_processing->storage(), 1};
   ProcessRequest processor{_storage_for_processing->storage()};
   par_state.oops_do(&processor);
+  processor.process_batch();
   _cur_stat.report_process_end();
 }
 
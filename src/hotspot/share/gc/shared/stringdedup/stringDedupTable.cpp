@@ -43,6 +43,7 @@
 #include "oops/typeArrayOop.inline.hpp"
 #include "oops/weakHandle.inline.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/growableArray.hpp"
@@ -129,6 +130,14 @@ class StringDedup::Table::Bucket {
 
   void shrink();
 
+  // Prefetch the hash codes.  The bucket itself should already be in the
+  // cache, or at least on its way there.
+  void prefetch_hashes() const {
+    if (!_hashes.is_empty()) {
+      Prefetch::read(_hashes.adr_at(0), 0);
+    }
+  }
+
   TableValue find(typeArrayOop obj, uint hash_code) const;
 
   void verify(size_t bucket_index, size_t bucket_count) const;
@@ -609,13 +618,39 @@ bool StringDedup::Table::deduplicate_if_permitted(oop java_string,
 
 void StringDedup::Table::deduplicate(oop java_string) {
   assert(java_lang_String::is_instance(java_string), "precondition");
+  deduplicate(java_string, compute_hash(java_lang_String::value(java_string)));
+}
+
+// Deduplicating a batch is done in three passes.  The first computes the
+// hash codes and prefetches the corresponding buckets.  The second
+// prefetches the hash code vectors of those buckets, which requires the
+// bucket to be loaded.  The last pass does the actual lookups.  This lets
+// the cache misses for the lookups of the strings in the batch overlap,
+// rather than taking them one after another.
+void StringDedup::Table::deduplicate(const oop* java_strings, size_t count) {
+  assert(count <= deduplicate_batch_size, "batch too large: %zu", count);
+  uint hash_codes[deduplicate_batch_size];
+  for (size_t i = 0; i < count; ++i) {
+    assert(java_lang_String::is_instance(java_strings[i]), "precondition");
+    hash_codes[i] = compute_hash(java_lang_String::value(java_strings[i]));
+    Prefetch::read(&_buckets[hash_to_index(hash_codes[i])], 0);
+  }
+  for (size_t i = 0; i < count; ++i) {
+    _buckets[hash_to_index(hash_codes[i])].prefetch_hashes();
+  }
+  for (size_t i = 0; i < count; ++i) {
+    deduplicate(java_strings[i], hash_codes[i]);
+  }
+}
+
+void StringDedup::Table::deduplicate(oop java_string, uint hash_code) {
   _cur_stat.inc_inspected();
   if ((StringTable::shared_entry_count() > 0) &&
       try_deduplicate_shared(java_string)) {
     return;                     // Done if deduplicated against shared StringTable.
   }
   typeArrayOop value = java_lang_String::value(java_string);
-  uint hash_code = compute_hash(value);
+  assert(hash_code == compute_hash(value), "invariant");
   TableValue tv = find(value, hash_code);
   if (tv.is_empty()) {
     // Not in table.  Create a new table entry.
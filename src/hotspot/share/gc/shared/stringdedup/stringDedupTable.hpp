@@ -95,6 +95,7 @@ class StringDedup::Table : AllStatic {
   static void add(TableValue tv, uint hash_code);
   static TableValue find(typeArrayOop obj, uint hash_code);
   static void install(typeArrayOop obj, uint hash_code);
+  static void deduplicate(oop java_string, uint hash_code);
   static bool deduplicate_if_permitted(oop java_string, typeArrayOop value);
   static bool try_deduplicate_shared(oop java_string);
   static bool try_deduplicate_found_shared(oop java_string, oop found);
@@ -117,6 +118,15 @@ class StringDedup::Table : AllStatic {
   // Otherwise, add the string's data array to the table.
   static void deduplicate(oop java_string);
 
+  // The maximum number of strings in a batch deduplication request.
+  static const size_t deduplicate_batch_size = 8;
+
+  // Deduplicate each of the count strings in java_strings, as if by calling
+  // deduplicate(oop) for each of them in order.  Lookups for the strings in
+  // the batch are overlapped, which is faster than separate calls.
+  // precondition: count <= deduplicate_batch_size
+  static void deduplicate(const oop* java_strings, size_t count);
+
   // Returns true if table needs to grow.
   static bool is_grow_needed();
 
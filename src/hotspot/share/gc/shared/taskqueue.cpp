@@ -36,7 +36,7 @@
 const char * const TaskQueueStats::_names[last_stat_id] = {
   "push", "pop", "pop-slow",
   "st-attempt", "st-empty", "st-ctdd", "st-success", "st-ctdd-max", "st-biasdrop",
-  "ovflw-push", "ovflw-max"
+  "ovflw-push", "ovflw-max", "ovflw-pub", "ovflw-steal"
 };
 
 TaskQueueStats & TaskQueueStats::operator +=(const TaskQueueStats & addend)
@@ -63,6 +63,8 @@ class TaskQueueStats {
     steal_bias_drop,  // number of times the bias has been dropped
     overflow,         // number of overflow pushes
     overflow_max_len, // max length of overflow stack
+    overflow_publish, // number of overflow chunks made stealable
+    overflow_steal,   // number of overflow chunks stolen
     last_stat_id
   };
 
@@ -83,6 +85,8 @@ class TaskQueueStats {
   }
   inline void record_bias_drop() { ++_stats[steal_bias_drop]; }
   inline void record_overflow(size_t new_length);
+  inline void record_overflow_publish() { ++_stats[overflow_publish]; }
+  inline void record_overflow_steal()   { ++_stats[overflow_steal]; }
 
   TaskQueueStats & operator +=(const TaskQueueStats & addend);
 
@@ -457,6 +461,91 @@ class OverflowTaskQueue: public GenericTaskQueue<E, F, N>
   overflow_t _overflow_stack;
 };
 
+// StealableOverflowTaskQueue is a TaskQueue with overflow storage that, unlike
+// the overflow stack of OverflowTaskQueue, can be stolen from.
+//
+// Elements that do not fit in the TaskQueue are collected in a chunk private
+// to the owner.  Once that chunk is full it is published on a per-queue list
+// of chunks.  Published chunks are taken as a whole, either by the owner when
+// its private chunk runs empty, or by a thief once stealing from the
+// TaskQueues failed.  A thief keeps one element of the chunk and pushes the
+// rest onto its own queue, so overflowed work is rebalanced in bulk.
+//
+// The list of published chunks is protected by a spin lock.  It is only
+// touched once per chunk, so contention is low.
+//
+// The interface matches OverflowTaskQueue, so the two can be interchanged.
+// Use StealableOverflowTaskQueueSet to also steal published chunks.
+template<class E, MEMFLAGS F, unsigned int N = TASKQUEUE_SIZE>
+class StealableOverflowTaskQueue: public GenericTaskQueue<E, F, N>
+{
+public:
+  typedef GenericTaskQueue<E, F, N> taskqueue_t;
+
+  TASKQUEUE_STATS_ONLY(using taskqueue_t::stats;)
+
+  static const uint ChunkSize = 256;
+
+  StealableOverflowTaskQueue();
+  ~StealableOverflowTaskQueue();
+
+  // Push task t onto the queue or into overflow storage.  Return true.
+  inline bool push(E t);
+  // Try to push task t onto the queue only. Returns true if successful, false otherwise.
+  inline bool try_push_to_taskqueue(E t);
+
+  // Attempt to pop from overflow storage, including published chunks; return
+  // true if anything was popped.  Only called by the owner.
+  inline bool pop_overflow(E& t);
+
+  // Attempt to take a published chunk from this queue on behalf of the
+  // (different) queue thief.  On success, one element is returned in t and
+  // the remaining elements are pushed onto thief.
+  bool steal_overflow_chunk(StealableOverflowTaskQueue* thief, E& t);
+
+  // Approximate number of elements in published chunks.
+  uint published_size() const {
+    return Atomic::load(&_num_published) * ChunkSize;
+  }
+
+  inline bool taskqueue_empty() const { return taskqueue_t::is_empty(); }
+  inline bool overflow_empty()  const {
+    return (_local == nullptr || _local->_top == 0) && Atomic::load(&_num_published) == 0;
+  }
+  inline bool is_empty()        const {
+    return taskqueue_empty() && overflow_empty();
+  }
+
+  void assert_empty() const {
+    taskqueue_t::assert_empty();
+    assert(overflow_empty(), "overflow not empty");
+  }
+
+private:
+  struct Chunk : public CHeapObj<F> {
+    Chunk* _next;
+    uint   _top;
+    E      _elems[ChunkSize];
+
+    Chunk() : _next(nullptr), _top(0) {}
+  };
+
+  // Owner only.
+  Chunk* _local;
+  Chunk* _free;
+
+  volatile int  _lock;
+  Chunk*        _published;
+  volatile uint _num_published;
+
+  void lock();
+  void unlock();
+
+  void publish(Chunk* chunk);
+  Chunk* take_published();
+};
+
+
 class TaskQueueSetSuper {
 public:
   // Assert all queues in the set are empty.
@@ -476,10 +565,11 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<F> {
   typedef typename T::element_type E;
   typedef typename T::PopResult PopResult;
 
-private:
+protected:
   uint _n;
   T** _queues;
 
+private:
   // Attempts to steal an element from a foreign queue (!= queue_num), setting
   // the result in t. Validity of this value and the return value is the same
   // as for the last pop_global() operation.
@@ -548,6 +638,23 @@ uint GenericTaskQueueSet<T, F>::tasks() const {
   return n;
 }
 
+// A task queue set that, if stealing from the TaskQueues fails, also steals
+// published overflow chunks.  T must be a StealableOverflowTaskQueue.
+template<class T, MEMFLAGS F>
+class StealableOverflowTaskQueueSet: public GenericTaskQueueSet<T, F> {
+  typedef GenericTaskQueueSet<T, F> base_t;
+
+public:
+  typedef typename base_t::E E;
+
+  StealableOverflowTaskQueueSet(uint n) : base_t(n) {}
+
+  // Hides GenericTaskQueueSet::steal().
+  bool steal(uint queue_num, E& t);
+
+  virtual uint tasks() const;
+};
+
 // When to terminate from the termination protocol.
 class TerminatorTerminator: public CHeapObj<mtInternal> {
 public:
@@ -36,6 +36,7 @@
 #include "runtime/orderAccess.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/ostream.hpp"
+#include "utilities/spinYield.hpp"
 #include "utilities/stack.inline.hpp"
 
 template <class T, MEMFLAGS F>
@@ -232,6 +233,155 @@ bool OverflowTaskQueue<E, F, N>::pop_overflow(E& t)
   return true;
 }
 
+template <class E, MEMFLAGS F, unsigned int N>
+StealableOverflowTaskQueue<E, F, N>::StealableOverflowTaskQueue() :
+  taskqueue_t(),
+  _local(nullptr),
+  _free(nullptr),
+  _lock(0),
+  _published(nullptr),
+  _num_published(0) {}
+
+template <class E, MEMFLAGS F, unsigned int N>
+StealableOverflowTaskQueue<E, F, N>::~StealableOverflowTaskQueue() {
+  delete _local;
+  delete _free;
+  while (_published != nullptr) {
+    Chunk* next = _published->_next;
+    delete _published;
+    _published = next;
+  }
+}
+
+template <class E, MEMFLAGS F, unsigned int N>
+void StealableOverflowTaskQueue<E, F, N>::lock() {
+  SpinYield spin;
+  while (Atomic::cmpxchg(&_lock, 0, 1) != 0) {
+    spin.wait();
+  }
+}
+
+template <class E, MEMFLAGS F, unsigned int N>
+void StealableOverflowTaskQueue<E, F, N>::unlock() {
+  Atomic::release_store(&_lock, 0);
+}
+
+template <class E, MEMFLAGS F, unsigned int N>
+void StealableOverflowTaskQueue<E, F, N>::publish(Chunk* chunk) {
+  lock();
+  chunk->_next = _published;
+  _published = chunk;
+  Atomic::store(&_num_published, _num_published + 1);
+  unlock();
+  TASKQUEUE_STATS_ONLY(stats.record_overflow_publish());
+}
+
+template <class E, MEMFLAGS F, unsigned int N>
+typename StealableOverflowTaskQueue<E, F, N>::Chunk*
+StealableOverflowTaskQueue<E, F, N>::take_published() {
+  if (Atomic::load(&_num_published) == 0) {
+    return nullptr;
+  }
+  lock();
+  Chunk* chunk = _published;
+  if (chunk != nullptr) {
+    _published = chunk->_next;
+    Atomic::store(&_num_published, _num_published - 1);
+  }
+  unlock();
+  return chunk;
+}
+
+template <class E, MEMFLAGS F, unsigned int N>
+inline bool StealableOverflowTaskQueue<E, F, N>::push(E t) {
+  if (taskqueue_t::push(t)) {
+    return true;
+  }
+  if (_local == nullptr) {
+    if (_free != nullptr) {
+      _local = _free;
+      _free = nullptr;
+    } else {
+      _local = new Chunk();
+    }
+  }
+  _local->_elems[_local->_top++] = t;
+  TASKQUEUE_STATS_ONLY(stats.record_overflow(_local->_top + published_size()));
+  if (_local->_top == ChunkSize) {
+    publish(_local);
+    _local = nullptr;
+  }
+  return true;
+}
+
+template <class E, MEMFLAGS F, unsigned int N>
+inline bool StealableOverflowTaskQueue<E, F, N>::try_push_to_taskqueue(E t) {
+  return taskqueue_t::push(t);
+}
+
+template <class E, MEMFLAGS F, unsigned int N>
+inline bool StealableOverflowTaskQueue<E, F, N>::pop_overflow(E& t) {
+  if (_local == nullptr || _local->_top == 0) {
+    Chunk* chunk = take_published();
+    if (chunk == nullptr) {
+      return false;
+    }
+    // Keep the now empty private chunk around for reuse.
+    if (_local != nullptr) {
+      delete _free;
+      _free = _local;
+    }
+    chunk->_next = nullptr;
+    _local = chunk;
+  }
+  t = _local->_elems[--_local->_top];
+  return true;
+}
+
+template <class E, MEMFLAGS F, unsigned int N>
+bool StealableOverflowTaskQueue<E, F, N>::steal_overflow_chunk(StealableOverflowTaskQueue* thief, E& t) {
+  assert(thief != this, "must not steal from own queue");
+  Chunk* chunk = take_published();
+  if (chunk == nullptr) {
+    return false;
+  }
+  TASKQUEUE_STATS_ONLY(thief->stats.record_overflow_steal());
+  assert(chunk->_top == ChunkSize, "only full chunks are published");
+  t = chunk->_elems[--chunk->_top];
+  while (chunk->_top > 0) {
+    thief->push(chunk->_elems[--chunk->_top]);
+  }
+  delete chunk;
+  return true;
+}
+
+template<class T, MEMFLAGS F>
+bool StealableOverflowTaskQueueSet<T, F>::steal(uint queue_num, E& t) {
+  if (base_t::steal(queue_num, t)) {
+    return true;
+  }
+  // The TaskQueues looked empty; try the published overflow chunks, starting
+  // with the queue after our own.
+  T* const thief = this->queue(queue_num);
+  const uint n = this->size();
+  for (uint i = 1; i < n; i++) {
+    T* const victim = this->queue((queue_num + i) % n);
+    if (victim->steal_overflow_chunk(thief, t)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+template<class T, MEMFLAGS F>
+uint StealableOverflowTaskQueueSet<T, F>::tasks() const {
+  uint n = base_t::tasks();
+  for (uint j = 0; j < this->_n; j++) {
+    n += this->_queues[j]->published_size();
+  }
+  return n;
+}
+
 // A pop_global operation may read an element that is being concurrently
 // written by a push operation.  The pop_global operation will not use
 // such an element, returning failure instead.  But the concurrent read
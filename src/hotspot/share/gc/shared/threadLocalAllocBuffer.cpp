@@ -85,21 +85,12 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
 
   print_stats("gc");
 
-  if (_number_of_refills > 0) {
-    // Update allocation history if a reasonable amount of eden was allocated.
-    bool update_allocation_history = used > 0.5 * capacity;
+  // Update allocation history if a reasonable amount of eden was allocated.
+  bool update_allocation_history = used > 0.5 * capacity;
 
+  if (_number_of_refills > 0) {
     if (update_allocation_history) {
-      // Average the fraction of eden allocated in a tlab by this
-      // thread for use in the next resize operation.
-      // _gc_waste is not subtracted because it's included in
-      // "used".
-      // The result can be larger than 1.0 due to direct to old allocations.
-      // These allocations should ideally not be counted but since it is not possible
-      // to filter them out here we just cap the fraction to be at most 1.0.
-      // Keep alloc_frac as float and not double to avoid the double to float conversion
-      float alloc_frac = MIN2(1.0f, allocated_since_last_gc / (float) used);
-      _allocation_fraction.sample(alloc_frac);
+      sample_allocation_fraction(allocated_since_last_gc, used);
     }
 
     stats->update_fast_allocations(_number_of_refills,
@@ -109,6 +100,13 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
   } else {
     assert(_number_of_refills == 0 && _refill_waste == 0 && _gc_waste == 0,
            "tlab stats == 0");
+    // A thread that didn't refill its TLAB since the last GC allocated
+    // little or nothing.  Without a sample its history, and so its TLAB
+    // size, stays at whatever it was when it was last busy, and its next
+    // TLAB wastes that much eden.
+    if (TLABSampleIdleThreads && update_allocation_history) {
+      sample_allocation_fraction(allocated_since_last_gc, used);
+    }
   }
 
   stats->update_slow_allocations(_slow_allocations);
@@ -116,6 +114,20 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
   reset_statistics();
 }
 
+void ThreadLocalAllocBuffer::sample_allocation_fraction(size_t allocated_since_last_gc,
+                                                        size_t used) {
+  // Average the fraction of eden allocated in a tlab by this
+  // thread for use in the next resize operation.
+  // _gc_waste is not subtracted because it's included in
+  // "used".
+  // The result can be larger than 1.0 due to direct to old allocations.
+  // These allocations should ideally not be counted but since it is not possible
+  // to filter them out here we just cap the fraction to be at most 1.0.
+  // Keep alloc_frac as float and not double to avoid the double to float conversion
+  float alloc_frac = MIN2(1.0f, allocated_since_last_gc / (float) used);
+  _allocation_fraction.sample(alloc_frac);
+}
+
 void ThreadLocalAllocBuffer::insert_filler() {
   assert(end() != nullptr, "Must not be retired");
   if (top() < hard_end()) {
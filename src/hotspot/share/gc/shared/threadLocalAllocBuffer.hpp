@@ -94,6 +94,7 @@ class ThreadLocalAllocBuffer: public CHeapObj<mtThread> {
   void insert_filler();
 
   void accumulate_and_reset_statistics(ThreadLocalAllocStats* stats);
+  void sample_allocation_fraction(size_t allocated_since_last_gc, size_t used);
 
   void print_stats(const char* tag);
 
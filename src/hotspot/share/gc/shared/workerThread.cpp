@@ -85,7 +85,8 @@ WorkerThreads::WorkerThreads(const char* name, uint max_workers) :
     _max_workers(max_workers),
     _created_workers(0),
     _active_workers(0),
-    _dispatcher() {}
+    _dispatcher(),
+    _task_worker_time_ns(0) {}
 
 void WorkerThreads::initialize_workers() {
   const uint initial_active_workers = UseDynamicNumberOfGCThreads ? 1 : _max_workers;
@@ -178,7 +179,9 @@ void WorkerThreads::clear_indirect_states() {
 
 void WorkerThreads::run_task(WorkerTask* task) {
   set_indirect_states();
+  jlong start = os::javaTimeNanos();
   _dispatcher.coordinator_distribute_task(task, _active_workers);
+  _task_worker_time_ns += (os::javaTimeNanos() - start) * _active_workers;
   clear_indirect_states();
 }
 
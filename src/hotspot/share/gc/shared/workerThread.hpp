@@ -90,6 +90,8 @@ class WorkerThreads : public CHeapObj<mtInternal> {
   uint                 _created_workers;
   uint                 _active_workers;
   WorkerTaskDispatcher _dispatcher;
+  // Wall time spent in run_task multiplied by the number of active workers.
+  jlong                _task_worker_time_ns;
 
   WorkerThread* create_worker(uint name_suffix);
 
@@ -110,6 +112,10 @@ class WorkerThreads : public CHeapObj<mtInternal> {
 
   uint set_active_workers(uint num_workers);
 
+  // Returns the worker time in nanoseconds available to tasks so far, i.e.
+  // the wall time of each run_task times its number of active workers.
+  jlong task_worker_time_ns() const { return _task_worker_time_ns; }
+
   void threads_do(ThreadClosure* tc) const;
   template <typename Function>
   void threads_do_f(Function function) const;
@@ -98,6 +98,11 @@ class ShenandoahAdaptiveHeuristics : public ShenandoahHeuristics {
 
   friend class ShenandoahAllocationRate;
 
+  void adjust_last_trigger_parameters(double amount);
+  void adjust_margin_of_error(double amount);
+  void adjust_spike_threshold(double amount);
+
+protected:
   // Used to record the last trigger that signaled to start a GC.
   // This itself is used to decide whether or not to adjust the margin of
   // error for the average cycle time and allocation rate or the allocation
@@ -106,11 +111,6 @@ class ShenandoahAdaptiveHeuristics : public ShenandoahHeuristics {
     SPIKE, RATE, OTHER
   };
 
-  void adjust_last_trigger_parameters(double amount);
-  void adjust_margin_of_error(double amount);
-  void adjust_spike_threshold(double amount);
-
-protected:
   ShenandoahAllocationRate _allocation_rate;
 
   // The margin of error expressed in standard deviations to add to our
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+
+#include "gc/shenandoah/heuristics/shenandoahPredictiveHeuristics.hpp"
+#include "gc/shenandoah/shenandoahCollectionSet.hpp"
+#include "gc/shenandoah/shenandoahHeap.inline.hpp"
+#include "gc/shenandoah/shenandoahHeapRegion.inline.hpp"
+#include "gc/shenandoah/shenandoahPhaseTimings.hpp"
+#include "logging/log.hpp"
+
+// Number of cycles to keep in the history, same as the cycle time history of other heuristics.
+static const int HistoryLength = 10;
+
+ShenandoahPhaseCostModel::ShenandoahPhaseCostModel() :
+  _cost(HistoryLength, ShenandoahAdaptiveDecayFactor) {
+}
+
+void ShenandoahPhaseCostModel::record(double time, size_t bytes) {
+  assert(bytes > 0, "Should have work to do");
+  _cost.add(time / bytes);
+}
+
+double ShenandoahPhaseCostModel::predict(size_t bytes, double sds) const {
+  if (!has_samples()) {
+    return 0.0;
+  }
+  // Never let the margin bring the prediction below the average.
+  double cost = _cost.davg() + MAX2(0.0, sds) * _cost.dsd();
+  return cost * bytes;
+}
+
+ShenandoahPredictiveHeuristics::ShenandoahPredictiveHeuristics(ShenandoahSpaceInfo* space_info) :
+  ShenandoahAdaptiveHeuristics(space_info),
+  _other(HistoryLength, ShenandoahAdaptiveDecayFactor),
+  _live(HistoryLength, ShenandoahAdaptiveDecayFactor),
+  _live_growth(HistoryLength, ShenandoahAdaptiveDecayFactor),
+  _cset_live(HistoryLength, ShenandoahAdaptiveDecayFactor),
+  _cycle_live(0),
+  _cycle_cset_live(0),
+  _cycle_used(0) { }
+
+void ShenandoahPredictiveHeuristics::choose_collection_set_from_regiondata(ShenandoahCollectionSet* cset,
+                                                                           RegionData* data, size_t size,
+                                                                           size_t actual_free) {
+  ShenandoahAdaptiveHeuristics::choose_collection_set_from_regiondata(cset, data, size, actual_free);
+
+  // Marking has just completed, remember how much work this cycle has to do.
+  ShenandoahHeap* heap = ShenandoahHeap::heap();
+  size_t live = 0;
+  for (size_t i = 0; i < heap->num_regions(); i++) {
+    live += heap->get_region(i)->get_live_data_bytes();
+  }
+
+  if (_live.num() > 0) {
+    _live_growth.add((double)live - _live.last());
+  }
+  _live.add((double)live);
+
+  _cycle_live = live;
+  _cycle_cset_live = cset->used() - cset->garbage();
+  _cycle_used = heap->used();
+  _cset_live.add((double)_cycle_cset_live);
+}
+
+void ShenandoahPredictiveHeuristics::record_success_concurrent() {
+  ShenandoahAdaptiveHeuristics::record_success_concurrent();
+
+  ShenandoahPhaseTimings* timings = ShenandoahHeap::heap()->phase_timings();
+  double mark        = timings->cycle_time(ShenandoahPhaseTimings::conc_mark_roots) +
+                       timings->cycle_time(ShenandoahPhaseTimings::conc_mark);
+  double evac        = timings->cycle_time(ShenandoahPhaseTimings::conc_evac);
+  double update_refs = timings->cycle_time(ShenandoahPhaseTimings::conc_update_refs);
+  double total       = time_since_last_gc();
+
+  // Abbreviated cycles skip evacuation and update references, only sample
+  // the phases that actually did their work.
+  if (_cycle_live > 0 && mark > 0) {
+    _mark.record(mark, _cycle_live);
+  }
+  if (_cycle_cset_live > 0 && evac > 0) {
+    _evac.record(evac, _cycle_cset_live);
+  }
+  if (_cycle_used > 0 && update_refs > 0) {
+    _update_refs.record(update_refs, _cycle_used);
+  }
+  _other.add(MAX2(0.0, total - mark - evac - update_refs));
+
+  log_debug(gc, ergo)("Cycle time %.2f ms: mark %.2f ms (" SIZE_FORMAT "%s live), evac %.2f ms (" SIZE_FORMAT "%s live), "
+                      "update refs %.2f ms (" SIZE_FORMAT "%s used), other %.2f ms",
+                      total * 1000,
+                      mark * 1000,        byte_size_in_proper_unit(_cycle_live),      proper_unit_for_byte_size(_cycle_live),
+                      evac * 1000,        byte_size_in_proper_unit(_cycle_cset_live), proper_unit_for_byte_size(_cycle_cset_live),
+                      update_refs * 1000, byte_size_in_proper_unit(_cycle_used),      proper_unit_for_byte_size(_cycle_used),
+                      _other.last() * 1000);
+
+  _cycle_live = 0;
+  _cycle_cset_live = 0;
+  _cycle_used = 0;
+}
+
+size_t ShenandoahPredictiveHeuristics::predict_cset_live(size_t capacity) const {
+  if (_cset_live.num() == 0) {
+    return 0;
+  }
+
+  // Adaptive collection set selection never takes more than the evacuation reserve allows.
+  size_t max_cset = (size_t)((1.0 * capacity / 100 * ShenandoahEvacReserve) / ShenandoahEvacWaste);
+  double cset_live = _cset_live.davg() + _margin_of_error_sd * _cset_live.dsd();
+  return MIN2((size_t)MAX2(0.0, cset_live), max_cset);
+}
+
+size_t ShenandoahPredictiveHeuristics::predict_live() const {
+  if (_live.num() == 0) {
+    return 0;
+  }
+
+  // Extrapolate the live data by its recent growth. Shrinking live data is
+  // not extrapolated, the last mark is the better guess then.
+  double growth = 0.0;
+  if (_live_growth.num() > 0) {
+    growth = MAX2(0.0, _live_growth.davg() + _margin_of_error_sd * _live_growth.dsd());
+  }
+  return (size_t)(_live.last() + growth);
+}
+
+bool ShenandoahPredictiveHeuristics::should_start_gc() {
+  if (ShenandoahAdaptiveHeuristics::should_start_gc()) {
+    return true;
+  }
+
+  // Wait for the adaptive heuristic to learn, and for the models to get samples.
+  if (_gc_times_learned < ShenandoahLearningSteps || !_mark.has_samples()) {
+    return false;
+  }
+
+  size_t max_capacity = _space_info->max_capacity();
+  size_t capacity = _space_info->soft_max_capacity();
+  size_t available = _space_info->available();
+
+  // Make sure the code below treats available without the soft tail.
+  size_t soft_tail = max_capacity - capacity;
+  available = (available > soft_tail) ? (available - soft_tail) : 0;
+
+  // Same headroom as in adaptive heuristic: absorb allocation spikes and
+  // account for the penalties from Degenerated and Full GC.
+  size_t allocation_headroom = available;
+  size_t spike_headroom = capacity / 100 * ShenandoahAllocSpikeFactor;
+  size_t penalties      = capacity / 100 * _gc_time_penalties;
+  allocation_headroom -= MIN2(allocation_headroom, spike_headroom);
+  allocation_headroom -= MIN2(allocation_headroom, penalties);
+
+  double alloc_rate = _allocation_rate.upper_bound(_margin_of_error_sd);
+  if (alloc_rate <= 0.0) {
+    return false;
+  }
+
+  ShenandoahHeap* heap = ShenandoahHeap::heap();
+  size_t live = predict_live();
+  size_t cset_live = predict_cset_live(capacity);
+  size_t used = heap->used();
+
+  double mark        = _mark.predict(live, _margin_of_error_sd);
+  double evac        = _evac.predict(cset_live, _margin_of_error_sd);
+  double update_refs = _update_refs.predict(used, _margin_of_error_sd);
+  double other       = _other.davg() + _margin_of_error_sd * _other.dsd();
+  double cycle_time  = mark + evac + update_refs + MAX2(0.0, other);
+
+  double margin = 1.0 + ShenandoahPredictiveMargin / 100.0;
+  double time_to_deplete = allocation_headroom / alloc_rate;
+  if (cycle_time * margin > time_to_deplete) {
+    log_info(gc)("Trigger: Predicted GC time (%.2f ms) is above the time for average allocation rate (%.0f %sB/s) to deplete free headroom (" SIZE_FORMAT "%s) (margin = " UINTX_FORMAT "%%)",
+                 cycle_time * 1000,
+                 byte_size_in_proper_unit(alloc_rate), proper_unit_for_byte_size(alloc_rate),
+                 byte_size_in_proper_unit(allocation_headroom), proper_unit_for_byte_size(allocation_headroom),
+                 ShenandoahPredictiveMargin);
+
+    log_info(gc, ergo)("Predicted GC time: %.2f ms (mark, " SIZE_FORMAT "%s live) + %.2f ms (evac, " SIZE_FORMAT "%s live) + %.2f ms (update refs, " SIZE_FORMAT "%s used) + %.2f ms (other) (margin of error = %.2f)",
+                       mark * 1000, byte_size_in_proper_unit(live), proper_unit_for_byte_size(live),
+                       evac * 1000, byte_size_in_proper_unit(cset_live), proper_unit_for_byte_size(cset_live),
+                       update_refs * 1000, byte_size_in_proper_unit(used), proper_unit_for_byte_size(used),
+                       other * 1000,
+                       _margin_of_error_sd);
+
+    _last_trigger = RATE;
+    return true;
+  }
+
+  return false;
+}
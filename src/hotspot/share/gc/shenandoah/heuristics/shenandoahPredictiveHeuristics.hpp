@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHENANDOAH_HEURISTICS_SHENANDOAHPREDICTIVEHEURISTICS_HPP
+#define SHARE_GC_SHENANDOAH_HEURISTICS_SHENANDOAHPREDICTIVEHEURISTICS_HPP
+
+#include "gc/shenandoah/heuristics/shenandoahAdaptiveHeuristics.hpp"
+#include "utilities/numberSeq.hpp"
+
+// Models the duration of a concurrent phase as the cost per byte of the work
+// the phase has to do, e.g. the live data for marking.
+class ShenandoahPhaseCostModel {
+private:
+  TruncatedSeq _cost;
+
+public:
+  ShenandoahPhaseCostModel();
+
+  void record(double time, size_t bytes);
+  bool has_samples() const { return _cost.num() > 0; }
+
+  // Predicted duration of the phase processing the given amount of bytes,
+  // taking the decaying average cost plus sds decaying standard deviations.
+  double predict(size_t bytes, double sds) const;
+};
+
+/*
+ * The predictive heuristic extends the adaptive heuristic. Instead of a single
+ * average cycle time, it predicts the duration of concurrent mark, evacuation
+ * and update references separately, from the cost per byte observed in the
+ * previous cycles and the expected amount of work for each:
+ *
+ *   - marking scales with the live data, which is extrapolated by its recent growth;
+ *   - evacuation scales with the live data in recent collection sets;
+ *   - update references scales with the used heap.
+ *
+ * Costs are taken from ShenandoahPhaseTimings at the end of each concurrent cycle.
+ * Predictions add the same margin of error (in standard deviations) the adaptive
+ * heuristic uses, so that degenerated and full cycles make predictions more
+ * conservative. A cycle is started when the predicted cycle time, inflated by
+ * ShenandoahPredictiveMargin, would not complete before the allocation rate
+ * depletes the headroom.
+ */
+class ShenandoahPredictiveHeuristics : public ShenandoahAdaptiveHeuristics {
+public:
+  ShenandoahPredictiveHeuristics(ShenandoahSpaceInfo* space_info);
+
+  virtual void choose_collection_set_from_regiondata(ShenandoahCollectionSet* cset,
+                                                     RegionData* data, size_t size,
+                                                     size_t actual_free);
+
+  void record_success_concurrent();
+
+  virtual bool should_start_gc();
+
+  virtual const char* name()     { return "Predictive"; }
+  virtual bool is_diagnostic()   { return false; }
+  virtual bool is_experimental() { return true; }
+
+private:
+  ShenandoahPhaseCostModel _mark;
+  ShenandoahPhaseCostModel _evac;
+  ShenandoahPhaseCostModel _update_refs;
+
+  // Rest of the cycle: pauses, root and weak reference processing, cleanup.
+  TruncatedSeq _other;
+
+  // Live data found by the last marks, and its growth from cycle to cycle.
+  TruncatedSeq _live;
+  TruncatedSeq _live_growth;
+
+  // Live data in the collection sets.
+  TruncatedSeq _cset_live;
+
+  // Work observed in the current cycle, recorded at collection set selection.
+  size_t _cycle_live;
+  size_t _cycle_cset_live;
+  size_t _cycle_used;
+
+  size_t predict_live() const;
+  size_t predict_cset_live(size_t capacity) const;
+};
+
+#endif // SHARE_GC_SHENANDOAH_HEURISTICS_SHENANDOAHPREDICTIVEHEURISTICS_HPP
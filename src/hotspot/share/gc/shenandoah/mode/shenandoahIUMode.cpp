@@ -26,6 +26,7 @@
 #include "gc/shenandoah/heuristics/shenandoahAdaptiveHeuristics.hpp"
 #include "gc/shenandoah/heuristics/shenandoahAggressiveHeuristics.hpp"
 #include "gc/shenandoah/heuristics/shenandoahCompactHeuristics.hpp"
+#include "gc/shenandoah/heuristics/shenandoahPredictiveHeuristics.hpp"
 #include "gc/shenandoah/heuristics/shenandoahStaticHeuristics.hpp"
 #include "gc/shenandoah/mode/shenandoahIUMode.hpp"
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
@@ -76,6 +77,8 @@ ShenandoahHeuristics* ShenandoahIUMode::initialize_heuristics() const {
     return new ShenandoahAdaptiveHeuristics(heap);
   } else if (strcmp(ShenandoahGCHeuristics, "compact") == 0) {
     return new ShenandoahCompactHeuristics(heap);
+  } else if (strcmp(ShenandoahGCHeuristics, "predictive") == 0) {
+    return new ShenandoahPredictiveHeuristics(heap);
   }
   vm_exit_during_initialization("Unknown -XX:ShenandoahGCHeuristics option");
   return nullptr;
@@ -63,8 +63,9 @@ void ShenandoahArguments::initialize() {
     }
   }
 
-  // Enable NUMA by default. While Shenandoah is not NUMA-aware, enabling NUMA makes
-  // storage allocation code NUMA-aware.
+  // Enable NUMA by default. This binds heap regions to NUMA nodes and makes free set
+  // prefer node-local regions, see ShenandoahNUMA. It also makes storage allocation
+  // code NUMA-aware.
   if (FLAG_IS_DEFAULT(UseNUMA)) {
     FLAG_SET_DEFAULT(UseNUMA, true);
   }
@@ -170,12 +170,14 @@ class ShenandoahUnlinkTask : public WorkerTask {
 private:
   ShenandoahNMethodUnlinkClosure      _cl;
   ShenandoahConcurrentNMethodIterator _iterator;
+  ShenandoahPhaseTimings::Phase const _phase;
 
 public:
-  ShenandoahUnlinkTask(bool unloading_occurred) :
+  ShenandoahUnlinkTask(bool unloading_occurred, ShenandoahPhaseTimings::Phase phase) :
     WorkerTask("Shenandoah Unlink NMethods"),
     _cl(unloading_occurred),
-    _iterator(ShenandoahCodeRoots::table()) {
+    _iterator(ShenandoahCodeRoots::table()),
+    _phase(phase) {
     _iterator.nmethods_do_begin();
   }
 
@@ -184,21 +186,32 @@ class ShenandoahUnlinkTask : public WorkerTask {
   }
 
   virtual void work(uint worker_id) {
+    ShenandoahConcurrentWorkerSession worker_session(worker_id);
+    ShenandoahWorkerTimingsTracker timer(_phase, ShenandoahPhaseTimings::CodeCacheUnload, worker_id);
     _iterator.nmethods_do(&_cl);
   }
 };
 
-void ShenandoahCodeRoots::unlink(WorkerThreads* workers, bool unloading_occurred) {
+void ShenandoahCodeRoots::unlink(WorkerThreads* workers, bool unloading_occurred, ShenandoahPhaseTimings::Phase phase) {
   assert(ShenandoahHeap::heap()->unload_classes(), "Only when running concurrent class unloading");
 
-  ShenandoahUnlinkTask task(unloading_occurred);
+  ShenandoahGCWorkerPhase worker_phase(phase);
+  ShenandoahUnlinkTask task(unloading_occurred, phase);
   workers->run_task(&task);
 }
 
 void ShenandoahCodeRoots::purge() {
   assert(ShenandoahHeap::heap()->unload_classes(), "Only when running concurrent class unloading");
 
-  ClassUnloadingContext::context()->purge_and_free_nmethods();
+  ClassUnloadingContext* ctx = ClassUnloadingContext::context();
+  {
+    ShenandoahTimingsTracker t(ShenandoahPhaseTimings::conc_class_unload_purge_coderoots_unregister);
+    ctx->purge_nmethods();
+  }
+  {
+    ShenandoahTimingsTracker t(ShenandoahPhaseTimings::conc_class_unload_purge_coderoots_free);
+    ctx->free_nmethods();
+  }
 }
 
 ShenandoahCodeRootsIterator::ShenandoahCodeRootsIterator() :
@@ -29,6 +29,7 @@
 #include "gc/shenandoah/shenandoahSharedVariables.hpp"
 #include "gc/shenandoah/shenandoahLock.hpp"
 #include "gc/shenandoah/shenandoahPadding.hpp"
+#include "gc/shenandoah/shenandoahPhaseTimings.hpp"
 #include "memory/allStatic.hpp"
 #include "memory/iterator.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -65,7 +66,7 @@ class ShenandoahCodeRoots : public AllStatic {
   }
 
   // Concurrent nmethod unloading support
-  static void unlink(WorkerThreads* workers, bool unloading_occurred);
+  static void unlink(WorkerThreads* workers, bool unloading_occurred, ShenandoahPhaseTimings::Phase phase);
   static void purge();
   static void arm_nmethods_for_mark();
   static void arm_nmethods_for_evac();
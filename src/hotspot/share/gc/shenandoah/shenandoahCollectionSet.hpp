@@ -30,6 +30,7 @@
 #include "gc/shenandoah/shenandoahHeap.hpp"
 #include "gc/shenandoah/shenandoahHeapRegion.hpp"
 #include "gc/shenandoah/shenandoahPadding.hpp"
+#include "runtime/atomic.hpp"
 
 class ShenandoahCollectionSet : public CHeapObj<mtGC> {
   friend class ShenandoahHeap;
@@ -70,6 +71,11 @@ class ShenandoahCollectionSet : public CHeapObj<mtGC> {
     _current_index = 0;
   }
 
+  // Regions below this index have been claimed by claim_next()
+  size_t claimed_index() const {
+    return Atomic::load(&_current_index);
+  }
+
   inline bool is_in(ShenandoahHeapRegion* r) const;
   inline bool is_in(size_t region_idx)       const;
   inline bool is_in(oop obj)                 const;
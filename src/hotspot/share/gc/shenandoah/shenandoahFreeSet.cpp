@@ -29,6 +29,8 @@
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegionSet.hpp"
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
+#include "gc/shenandoah/shenandoahMonitoringSupport.hpp"
+#include "gc/shenandoah/shenandoahNUMA.hpp"
 #include "gc/shenandoah/shenandoahSimpleBitMap.hpp"
 #include "gc/shenandoah/shenandoahSimpleBitMap.inline.hpp"
 #include "logging/logStream.hpp"
@@ -578,7 +580,8 @@ ShenandoahFreeSet::ShenandoahFreeSet(ShenandoahHeap* heap, size_t max_regions) :
   _heap(heap),
   _partitions(max_regions, this),
   _right_to_left_bias(false),
-  _alloc_bias_weight(0)
+  _alloc_bias_weight(0),
+  _evac_headroom(0)
 {
   clear_internal();
 }
@@ -625,66 +628,47 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
         _right_to_left_bias = (non_empty_on_right > non_empty_on_left);
         _alloc_bias_weight = _InitialAllocBiasWeight;
       }
-      if (_right_to_left_bias) {
-        // Allocate within mutator free from high memory to low so as to preserve low memory for humongous allocations
-        if (!_partitions.is_empty(ShenandoahFreeSetPartitionId::Mutator)) {
-          // Use signed idx.  Otherwise, loop will never terminate.
-          idx_t leftmost = _partitions.leftmost(ShenandoahFreeSetPartitionId::Mutator);
-          for (idx_t idx = _partitions.rightmost(ShenandoahFreeSetPartitionId::Mutator); idx >= leftmost; ) {
-            assert(_partitions.in_free_set(ShenandoahFreeSetPartitionId::Mutator, idx),
-                   "Boundaries or find_last_set_bit failed: " SSIZE_FORMAT, idx);
-            ShenandoahHeapRegion* r = _heap->get_region(idx);
-            // try_allocate_in() increases used if the allocation is successful.
-            HeapWord* result;
-            size_t min_size = (req.type() == ShenandoahAllocRequest::_alloc_tlab)? req.min_size(): req.size();
-            if ((alloc_capacity(r) >= min_size) && ((result = try_allocate_in(r, req, in_new_region)) != nullptr)) {
-              return result;
-            }
-            idx = _partitions.find_index_of_previous_available_region(ShenandoahFreeSetPartitionId::Mutator, idx - 1);
-          }
-        }
-      } else {
-        // Allocate from low to high memory.  This keeps the range of fully empty regions more tightly packed.
-        // Note that the most recently allocated regions tend not to be evacuated in a given GC cycle.  So this
-        // tends to accumulate "fragmented" uncollected regions in high memory.
-        if (!_partitions.is_empty(ShenandoahFreeSetPartitionId::Mutator)) {
-          // Use signed idx.  Otherwise, loop will never terminate.
-          idx_t rightmost = _partitions.rightmost(ShenandoahFreeSetPartitionId::Mutator);
-          for (idx_t idx = _partitions.leftmost(ShenandoahFreeSetPartitionId::Mutator); idx <= rightmost; ) {
-            assert(_partitions.in_free_set(ShenandoahFreeSetPartitionId::Mutator, idx),
-                   "Boundaries or find_last_set_bit failed: " SSIZE_FORMAT, idx);
-            ShenandoahHeapRegion* r = _heap->get_region(idx);
-            // try_allocate_in() increases used if the allocation is successful.
-            HeapWord* result;
-            size_t min_size = (req.type() == ShenandoahAllocRequest::_alloc_tlab)? req.min_size(): req.size();
-            if ((alloc_capacity(r) >= min_size) && ((result = try_allocate_in(r, req, in_new_region)) != nullptr)) {
-              return result;
-            }
-            idx = _partitions.find_index_of_next_available_region(ShenandoahFreeSetPartitionId::Mutator, idx + 1);
-          }
+      if (ShenandoahNUMA::is_enabled()) {
+        // Try the regions on the node of allocating thread first, then the rest of the heap.
+        uint node = ShenandoahNUMA::index_of_current_thread();
+        HeapWord* result = allocate_from_mutator(req, in_new_region,
+                                                 ShenandoahNUMA::first_region(node),
+                                                 ShenandoahNUMA::first_region(node + 1) - 1);
+        if (result != nullptr) {
+          return result;
         }
       }
-      // There is no recovery. Mutator does not touch collector view at all.
-      break;
+      return allocate_from_mutator(req, in_new_region, 0, _partitions.max_regions() - 1);
     }
     case ShenandoahAllocRequest::_alloc_gclab:
       // GCLABs are for evacuation so we must be in evacuation phase.
 
     case ShenandoahAllocRequest::_alloc_shared_gc: {
-      // Fast-path: try to allocate in the collector view first
-      idx_t leftmost_collector = _partitions.leftmost(ShenandoahFreeSetPartitionId::Collector);
-      for (idx_t idx = _partitions.rightmost(ShenandoahFreeSetPartitionId::Collector); idx >= leftmost_collector; ) {
-        assert(_partitions.in_free_set(ShenandoahFreeSetPartitionId::Collector, idx),
-               "Boundaries or find_prev_last_bit failed: " SSIZE_FORMAT, idx);
-        HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
+      // GCLABs leave the headroom to shared evacuations. They may still take empty regions from mutator view.
+      bool in_headroom = req.is_lab_alloc() &&
+                         _partitions.available_in(ShenandoahFreeSetPartitionId::Collector) < _evac_headroom + req.min_size() * HeapWordSize;
+      if (!in_headroom) {
+        // Fast-path: try to allocate in the collector view first, preferring the node of evacuating thread
+        if (ShenandoahNUMA::is_enabled()) {
+          uint node = ShenandoahNUMA::index_of_current_thread();
+          HeapWord* result = allocate_from_collector(req, in_new_region,
+                                                     ShenandoahNUMA::first_region(node),
+                                                     ShenandoahNUMA::first_region(node + 1) - 1);
+          if (result != nullptr) {
+            return result;
+          }
+        }
+        HeapWord* result = allocate_from_collector(req, in_new_region, 0, _partitions.max_regions() - 1);
         if (result != nullptr) {
           return result;
         }
-        idx = _partitions.find_index_of_previous_available_region(ShenandoahFreeSetPartitionId::Collector, idx - 1);
       }
 
       // No dice. Can we borrow space from mutator view?
       if (!ShenandoahEvacReserveOverflow) {
+        if (in_headroom) {
+          _heap->monitoring_support()->record_gclab_denied();
+        }
         return nullptr;
       }
 
@@ -707,6 +691,9 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
 
       // No dice. Do not try to mix mutator and GC allocations, because adjusting region UWM
       // due to GC allocations would expose unparsable mutator allocations.
+      if (in_headroom) {
+        _heap->monitoring_support()->record_gclab_denied();
+      }
       break;
     }
     default:
@@ -715,6 +702,65 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
   return nullptr;
 }
 
+HeapWord* ShenandoahFreeSet::allocate_from_mutator(ShenandoahAllocRequest& req, bool& in_new_region, idx_t low, idx_t high) {
+  if (_partitions.is_empty(ShenandoahFreeSetPartitionId::Mutator)) {
+    return nullptr;
+  }
+
+  size_t min_size = (req.type() == ShenandoahAllocRequest::_alloc_tlab)? req.min_size(): req.size();
+  if (_right_to_left_bias) {
+    // Allocate within mutator free from high memory to low so as to preserve low memory for humongous allocations
+    // Use signed idx.  Otherwise, loop will never terminate.
+    idx_t leftmost = MAX2(_partitions.leftmost(ShenandoahFreeSetPartitionId::Mutator), low);
+    for (idx_t idx = _partitions.find_index_of_previous_available_region(ShenandoahFreeSetPartitionId::Mutator, high);
+         idx >= leftmost; ) {
+      assert(_partitions.in_free_set(ShenandoahFreeSetPartitionId::Mutator, idx),
+             "Boundaries or find_last_set_bit failed: " SSIZE_FORMAT, idx);
+      ShenandoahHeapRegion* r = _heap->get_region(idx);
+      // try_allocate_in() increases used if the allocation is successful.
+      HeapWord* result;
+      if ((alloc_capacity(r) >= min_size) && ((result = try_allocate_in(r, req, in_new_region)) != nullptr)) {
+        return result;
+      }
+      idx = _partitions.find_index_of_previous_available_region(ShenandoahFreeSetPartitionId::Mutator, idx - 1);
+    }
+  } else {
+    // Allocate from low to high memory.  This keeps the range of fully empty regions more tightly packed.
+    // Note that the most recently allocated regions tend not to be evacuated in a given GC cycle.  So this
+    // tends to accumulate "fragmented" uncollected regions in high memory.
+    // Use signed idx.  Otherwise, loop will never terminate.
+    idx_t rightmost = MIN2(_partitions.rightmost(ShenandoahFreeSetPartitionId::Mutator), high);
+    for (idx_t idx = _partitions.find_index_of_next_available_region(ShenandoahFreeSetPartitionId::Mutator, low);
+         idx <= rightmost; ) {
+      assert(_partitions.in_free_set(ShenandoahFreeSetPartitionId::Mutator, idx),
+             "Boundaries or find_last_set_bit failed: " SSIZE_FORMAT, idx);
+      ShenandoahHeapRegion* r = _heap->get_region(idx);
+      // try_allocate_in() increases used if the allocation is successful.
+      HeapWord* result;
+      if ((alloc_capacity(r) >= min_size) && ((result = try_allocate_in(r, req, in_new_region)) != nullptr)) {
+        return result;
+      }
+      idx = _partitions.find_index_of_next_available_region(ShenandoahFreeSetPartitionId::Mutator, idx + 1);
+    }
+  }
+  return nullptr;
+}
+
+HeapWord* ShenandoahFreeSet::allocate_from_collector(ShenandoahAllocRequest& req, bool& in_new_region, idx_t low, idx_t high) {
+  idx_t leftmost_collector = MAX2(_partitions.leftmost(ShenandoahFreeSetPartitionId::Collector), low);
+  for (idx_t idx = _partitions.find_index_of_previous_available_region(ShenandoahFreeSetPartitionId::Collector, high);
+       idx >= leftmost_collector; ) {
+    assert(_partitions.in_free_set(ShenandoahFreeSetPartitionId::Collector, idx),
+           "Boundaries or find_prev_last_bit failed: " SSIZE_FORMAT, idx);
+    HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
+    if (result != nullptr) {
+      return result;
+    }
+    idx = _partitions.find_index_of_previous_available_region(ShenandoahFreeSetPartitionId::Collector, idx - 1);
+  }
+  return nullptr;
+}
+
 HeapWord* ShenandoahFreeSet::try_allocate_in(ShenandoahHeapRegion* r, ShenandoahAllocRequest& req, bool& in_new_region) {
   assert (has_alloc_capacity(r), "Performance: should avoid full regions on this path: " SIZE_FORMAT, r->index());
   if (_heap->is_concurrent_weak_root_in_progress() && r->is_trash()) {
@@ -1078,6 +1124,7 @@ void ShenandoahFreeSet::finish_rebuild(size_t cset_regions) {
   }
 
   reserve_regions(reserve);
+  _evac_headroom = _partitions.available_in(ShenandoahFreeSetPartitionId::Collector) * ShenandoahEvacOOMHeadroom / 100;
   _partitions.assert_bounds();
   log_status();
 }
@@ -1089,7 +1136,32 @@ void ShenandoahFreeSet::rebuild() {
 }
 
 void ShenandoahFreeSet::reserve_regions(size_t to_reserve) {
-  for (size_t i = _heap->num_regions(); i > 0; i--) {
+  if (ShenandoahNUMA::is_enabled()) {
+    size_t to_reserve_per_node = to_reserve / ShenandoahNUMA::count();
+    for (uint node = 0; node < ShenandoahNUMA::count(); node++) {
+      reserve_regions_in_range(ShenandoahNUMA::first_region(node), ShenandoahNUMA::first_region(node + 1) - 1,
+                               to_reserve_per_node);
+    }
+  }
+
+  // Reserve the rest from wherever it is available
+  size_t reserved = _partitions.available_in(ShenandoahFreeSetPartitionId::Collector);
+  if (reserved < to_reserve) {
+    reserve_regions_in_range(0, _heap->num_regions() - 1, to_reserve - reserved);
+  }
+
+  if (LogTarget(Info, gc, free)::is_enabled()) {
+    size_t reserve = _partitions.capacity_of(ShenandoahFreeSetPartitionId::Collector);
+    if (reserve < to_reserve) {
+      log_debug(gc)("Wanted " PROPERFMT " for young reserve, but only reserved: " PROPERFMT,
+                    PROPERFMTARGS(to_reserve), PROPERFMTARGS(reserve));
+    }
+  }
+}
+
+void ShenandoahFreeSet::reserve_regions_in_range(size_t low, size_t high, size_t to_reserve) {
+  size_t reserved = 0;
+  for (size_t i = high + 1; i > low; i--) {
     size_t idx = i - 1;
     ShenandoahHeapRegion* r = _heap->get_region(idx);
 
@@ -1100,7 +1172,7 @@ void ShenandoahFreeSet::reserve_regions(size_t to_reserve) {
     size_t ac = alloc_capacity(r);
     assert (ac > 0, "Membership in free partition implies has capacity");
 
-    bool move_to_collector = _partitions.available_in(ShenandoahFreeSetPartitionId::Collector) < to_reserve;
+    bool move_to_collector = reserved < to_reserve;
     if (!move_to_collector) {
       // We've satisfied to_reserve
       break;
@@ -1117,17 +1189,10 @@ void ShenandoahFreeSet::reserve_regions(size_t to_reserve) {
       // collection set, and they are easily evacuated because they have low density of live objects.
       _partitions.move_from_partition_to_partition(idx, ShenandoahFreeSetPartitionId::Mutator,
                                                    ShenandoahFreeSetPartitionId::Collector, ac);
+      reserved += ac;
       log_debug(gc)("  Shifting region " SIZE_FORMAT " from mutator_free to collector_free", idx);
     }
   }
-
-  if (LogTarget(Info, gc, free)::is_enabled()) {
-    size_t reserve = _partitions.capacity_of(ShenandoahFreeSetPartitionId::Collector);
-    if (reserve < to_reserve) {
-      log_debug(gc)("Wanted " PROPERFMT " for young reserve, but only reserved: " PROPERFMT,
-                    PROPERFMTARGS(to_reserve), PROPERFMTARGS(reserve));
-    }
-  }
 }
 
 void ShenandoahFreeSet::log_status() {
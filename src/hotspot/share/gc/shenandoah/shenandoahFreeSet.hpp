@@ -271,6 +271,11 @@ class ShenandoahFreeSet : public CHeapObj<mtGC> {
 
   const ssize_t _InitialAllocBiasWeight = 256;
 
+  // Part of the evacuation reserve that GCLAB refills may not consume. Evacuating threads that cannot
+  // refill their GCLAB fall back to shared allocations, which may use it, so that the evacuation OOM
+  // protocol is only entered when the reserve is truly exhausted.
+  size_t _evac_headroom;
+
   HeapWord* try_allocate_in(ShenandoahHeapRegion* region, ShenandoahAllocRequest& req, bool& in_new_region);
 
   // While holding the heap lock, allocate memory for a single object or LAB  which is to be entirely contained
@@ -279,6 +284,11 @@ class ShenandoahFreeSet : public CHeapObj<mtGC> {
   // Precondition: req.size() <= ShenandoahHeapRegion::humongous_threshold_words().
   HeapWord* allocate_single(ShenandoahAllocRequest& req, bool& in_new_region);
 
+  // Allocate within regions low through high inclusive from the Mutator and Collector partitions respectively.
+  // With NUMA, the range is used to look for the regions on the node of allocating thread first.
+  HeapWord* allocate_from_mutator(ShenandoahAllocRequest& req, bool& in_new_region, idx_t low, idx_t high);
+  HeapWord* allocate_from_collector(ShenandoahAllocRequest& req, bool& in_new_region, idx_t low, idx_t high);
+
   // While holding the heap lock, allocate memory for a humongous object which spans one or more regions that
   // were previously empty.  Regions that represent humongous objects are entirely dedicated to the humongous
   // object.  No other objects are packed into these regions.
@@ -310,9 +320,14 @@ class ShenandoahFreeSet : public CHeapObj<mtGC> {
 
   // Having placed all regions that have allocation capacity into the mutator partition, move some of these regions from
   // the mutator partition into the collector partition in order to assure that the memory available for allocations within
-  // the collector partition is at least to_reserve.
+  // the collector partition is at least to_reserve.  With NUMA, each node reserves its share of to_reserve at the
+  // high end of its own range of regions, so that evacuating threads find collector memory on their own node.
   void reserve_regions(size_t to_reserve);
 
+  // Move regions low through high inclusive, starting from the highest, from the mutator partition into the collector
+  // partition until at least to_reserve bytes have been moved.
+  void reserve_regions_in_range(size_t low, size_t high, size_t to_reserve);
+
   // Overwrite arguments to represent the number of regions to be reclaimed from the cset
   void prepare_to_rebuild(size_t &cset_regions);
 
@@ -275,6 +275,7 @@ class ShenandoahPrepareForMarkClosure: public ShenandoahHeapRegionClosure {
   void heap_region_do(ShenandoahHeapRegion *r) {
     _ctx->capture_top_at_mark_start(r);
     r->clear_live_data();
+    r->clear_has_references();
   }
 
   bool is_thread_safe() { return true; }
@@ -948,6 +949,12 @@ class ShenandoahPostCompactClosure : public ShenandoahHeapRegionClosure {
     }
 
     r->set_live_data(live);
+    // Objects have moved, mark-time reference summary is stale now
+    if (live > 0) {
+      r->set_has_references();
+    } else {
+      r->clear_has_references();
+    }
     r->reset_alloc_metadata();
     _live += live;
   }
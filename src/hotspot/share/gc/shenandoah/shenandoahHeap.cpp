@@ -53,6 +53,7 @@
 #include "gc/shenandoah/shenandoahMemoryPool.hpp"
 #include "gc/shenandoah/shenandoahMetrics.hpp"
 #include "gc/shenandoah/shenandoahMonitoringSupport.hpp"
+#include "gc/shenandoah/shenandoahNUMA.hpp"
 #include "gc/shenandoah/shenandoahOopClosures.inline.hpp"
 #include "gc/shenandoah/shenandoahPacer.inline.hpp"
 #include "gc/shenandoah/shenandoahPadding.hpp"
@@ -192,6 +193,8 @@ jint ShenandoahHeap::initialize() {
   _heap_region = MemRegion((HeapWord*)heap_rs.base(), heap_rs.size() / HeapWordSize);
   _heap_region_special = heap_rs.special();
 
+  ShenandoahNUMA::initialize(_num_regions, reg_size_bytes, heap_page_size);
+
   assert((((size_t) base()) & ShenandoahHeapRegion::region_size_bytes_mask()) == 0,
          "Misaligned heap: " PTR_FORMAT, p2i(base()));
   os::trace_page_sizes_for_requested_size("Heap",
@@ -262,6 +265,9 @@ jint ShenandoahHeap::initialize() {
   if (!_bitmap_region_special) {
     os::commit_memory_or_exit((char *) _bitmap_region.start(), bitmap_init_commit, bitmap_page_size, false,
                               "Cannot commit bitmap memory");
+    _bitmap_committed = bitmap_init_commit;
+  } else {
+    _bitmap_committed = _bitmap_size;
   }
 
   _marking_context = new ShenandoahMarkingContext(_heap_region, _bitmap_region, _num_regions, _max_workers);
@@ -365,6 +371,10 @@ jint ShenandoahHeap::initialize() {
       bool is_committed = i < num_committed_regions;
       void* loc = region_storage.base() + i * region_align;
 
+      if (is_committed) {
+        ShenandoahNUMA::request_memory_on_node(start, reg_size_bytes, i);
+      }
+
       ShenandoahHeapRegion* r = new (loc) ShenandoahHeapRegion(start, i, is_committed);
       assert(is_aligned(r, SHENANDOAH_CACHE_LINE_SIZE), "Sanity");
 
@@ -524,6 +534,7 @@ ShenandoahHeap::ShenandoahHeap(ShenandoahCollectorPolicy* policy) :
   _bitmap_size(0),
   _bitmap_regions_per_slice(0),
   _bitmap_bytes_per_slice(0),
+  _bitmap_committed(0),
   _bitmap_region_special(false),
   _aux_bitmap_region_special(false),
   _liveness_cache(nullptr),
@@ -592,6 +603,10 @@ void ShenandoahHeap::print_on(outputStream* st) const {
                num_regions(),
                byte_size_in_proper_unit(ShenandoahHeapRegion::region_size_bytes()),
                proper_unit_for_byte_size(ShenandoahHeapRegion::region_size_bytes()));
+  st->print_cr(" " SIZE_FORMAT "%s mark bitmap reserved, " SIZE_FORMAT "%s committed, in slices of " SIZE_FORMAT " regions",
+               byte_size_in_proper_unit(_bitmap_size),      proper_unit_for_byte_size(_bitmap_size),
+               byte_size_in_proper_unit(_bitmap_committed), proper_unit_for_byte_size(_bitmap_committed),
+               _bitmap_regions_per_slice);
 
   st->print("Status: ");
   if (has_forwarded_objects())                 st->print("has forwarded objects, ");
@@ -807,6 +822,8 @@ void ShenandoahHeap::op_uncommit(double shrink_before, size_t shrink_until) {
   }
 
   if (count > 0) {
+    log_debug(gc)("Uncommitted " SIZE_FORMAT " regions, mark bitmap committed: " SIZE_FORMAT "%s",
+                  count, byte_size_in_proper_unit(bitmap_committed()), proper_unit_for_byte_size(bitmap_committed()));
     notify_heap_changed();
   }
 }
@@ -1156,6 +1173,7 @@ oop ShenandoahHeap::evacuate_object(oop p, Thread* thread) {
   if (copy == nullptr) {
     control_thread()->handle_alloc_failure_evac(size);
 
+    monitoring_support()->record_evac_oom();
     _oom_evac_handler.handle_out_of_memory_during_evacuation();
 
     return ShenandoahBarrierSet::resolve_forwarded(p);
@@ -1747,6 +1765,7 @@ class ShenandoahResetUpdateRegionStateClosure : public ShenandoahHeapRegionClosu
       // Reset live data and set TAMS optimistically. We would recheck these under the pause
       // anyway to capture any updates that happened since now.
       r->clear_live_data();
+      r->clear_has_references();
       _ctx->capture_top_at_mark_start(r);
     }
   }
@@ -2188,6 +2207,16 @@ class ShenandoahUpdateHeapRefsTask : public WorkerTask {
   }
 
 private:
+  // Marked objects below TAMS were all scanned by marking, which summarized whether
+  // any of them can hold references. Objects allocated above TAMS were not scanned,
+  // so regions updated past TAMS are always visited.
+  static bool may_have_references(ShenandoahHeapRegion* r, ShenandoahMarkingContext* ctx, HeapWord* update_watermark) {
+    if (!ShenandoahUpdateRefsSkipRefFree) {
+      return true;
+    }
+    return r->has_references() || update_watermark > ctx->top_at_mark_start(r);
+  }
+
   template<class T>
   void do_work(uint worker_id) {
     T cl;
@@ -2206,7 +2235,7 @@ class ShenandoahUpdateHeapRefsTask : public WorkerTask {
     while (r != nullptr) {
       HeapWord* update_watermark = r->get_update_watermark();
       assert (update_watermark >= r->bottom(), "sanity");
-      if (r->is_active() && !r->is_cset()) {
+      if (r->is_active() && !r->is_cset() && may_have_references(r, ctx, update_watermark)) {
         _heap->marked_object_oop_iterate(r, &cl, update_watermark);
       }
       if (ShenandoahPacing) {
@@ -2338,6 +2367,7 @@ bool ShenandoahHeap::commit_bitmap_slice(ShenandoahHeapRegion* r) {
   if (!os::commit_memory(start, len, false)) {
     return false;
   }
+  _bitmap_committed += len;
 
   if (AlwaysPreTouch) {
     os::pretouch_memory(start, start + len, _pretouch_bitmap_page_size);
@@ -2367,6 +2397,8 @@ bool ShenandoahHeap::uncommit_bitmap_slice(ShenandoahHeapRegion *r) {
   if (!os::uncommit_memory((char*)_bitmap_region.start() + off, len)) {
     return false;
   }
+  assert(_bitmap_committed >= len, "sanity");
+  _bitmap_committed -= len;
   return true;
 }
 
@@ -580,6 +580,7 @@ class ShenandoahHeap : public CollectedHeap, public ShenandoahSpaceInfo {
   size_t _bitmap_size;
   size_t _bitmap_regions_per_slice;
   size_t _bitmap_bytes_per_slice;
+  size_t _bitmap_committed;
 
   size_t _pretouch_heap_page_size;
   size_t _pretouch_bitmap_page_size;
@@ -613,6 +614,7 @@ class ShenandoahHeap : public CollectedHeap, public ShenandoahSpaceInfo {
   bool commit_bitmap_slice(ShenandoahHeapRegion *r);
   bool uncommit_bitmap_slice(ShenandoahHeapRegion *r);
   bool is_bitmap_slice_committed(ShenandoahHeapRegion* r, bool skip_self = false);
+  size_t bitmap_committed() const { return _bitmap_committed; }
 
   // Liveness caching support
   ShenandoahLiveData* get_liveness_cache(uint worker_id);
@@ -30,6 +30,7 @@
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegion.hpp"
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
+#include "gc/shenandoah/shenandoahNUMA.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "memory/allocation.hpp"
 #include "memory/iterator.inline.hpp"
@@ -68,6 +69,7 @@ ShenandoahHeapRegion::ShenandoahHeapRegion(HeapWord* start, size_t index, bool c
   _gclab_allocs(0),
   _live_data(0),
   _critical_pins(0),
+  _has_references(false),
   _update_watermark(start) {
 
   assert(Universe::on_page_boundary(_bottom) && Universe::on_page_boundary(_end),
@@ -429,6 +431,7 @@ ShenandoahHeapRegion* ShenandoahHeapRegion::humongous_start_region() const {
 void ShenandoahHeapRegion::recycle() {
   set_top(bottom());
   clear_live_data();
+  clear_has_references();
 
   reset_alloc_metadata();
 
@@ -623,6 +626,7 @@ void ShenandoahHeapRegion::do_commit() {
   if (!heap->is_heap_region_special() && !os::commit_memory((char *) bottom(), RegionSizeBytes, false)) {
     report_java_out_of_memory("Unable to commit region");
   }
+  ShenandoahNUMA::request_memory_on_node(bottom(), RegionSizeBytes, index());
   if (!heap->commit_bitmap_slice(this)) {
     report_java_out_of_memory("Unable to commit bitmaps for region");
   }
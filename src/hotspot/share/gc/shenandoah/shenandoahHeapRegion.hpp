@@ -242,6 +242,7 @@ class ShenandoahHeapRegion {
 
   volatile size_t _live_data;
   volatile size_t _critical_pins;
+  volatile bool _has_references;
 
   HeapWord* volatile _update_watermark;
 
@@ -387,6 +388,12 @@ class ShenandoahHeapRegion {
   inline void set_update_watermark(HeapWord* w);
   inline void set_update_watermark_at_safepoint(HeapWord* w);
 
+  // Marking summary: whether any object marked in this region can hold references.
+  // Regions without such objects below TAMS have nothing to update after evacuation.
+  inline bool has_references() const;
+  inline void set_has_references();
+  inline void clear_has_references();
+
 private:
   void do_commit();
   void do_uncommit();
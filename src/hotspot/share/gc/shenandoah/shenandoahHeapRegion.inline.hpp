@@ -133,4 +133,19 @@ inline void ShenandoahHeapRegion::set_update_watermark_at_safepoint(HeapWord* w)
   _update_watermark = w;
 }
 
+inline bool ShenandoahHeapRegion::has_references() const {
+  return Atomic::load(&_has_references);
+}
+
+inline void ShenandoahHeapRegion::set_has_references() {
+  // Racy, but all racing threads store the same value
+  if (!has_references()) {
+    Atomic::store(&_has_references, true);
+  }
+}
+
+inline void ShenandoahHeapRegion::clear_has_references() {
+  Atomic::store(&_has_references, false);
+}
+
 #endif // SHARE_GC_SHENANDOAH_SHENANDOAHHEAPREGION_INLINE_HPP
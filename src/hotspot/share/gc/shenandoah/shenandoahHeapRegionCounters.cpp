@@ -27,11 +27,14 @@
 #include "gc/shenandoah/shenandoahHeapRegion.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegionSet.hpp"
 #include "gc/shenandoah/shenandoahHeapRegionCounters.hpp"
+#include "gc/shenandoah/shenandoahNUMA.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/perfData.inline.hpp"
 
 ShenandoahHeapRegionCounters::ShenandoahHeapRegionCounters() :
+  _nodes_used(nullptr),
+  _nodes_free(nullptr),
   _last_sample_millis(0)
 {
   if (UsePerfData && ShenandoahRegionSampling) {
@@ -52,6 +55,9 @@ ShenandoahHeapRegionCounters::ShenandoahHeapRegionCounters() :
     cname = PerfDataManager::counter_name(_name_space, "region_size");
     PerfDataManager::create_constant(SUN_GC, cname, PerfData::U_None, ShenandoahHeapRegion::region_size_bytes() >> 10, CHECK);
 
+    cname = PerfDataManager::counter_name(_name_space, "numa_nodes");
+    PerfDataManager::create_constant(SUN_GC, cname, PerfData::U_None, ShenandoahNUMA::count(), CHECK);
+
     cname = PerfDataManager::counter_name(_name_space, "status");
     _status = PerfDataManager::create_long_variable(SUN_GC, cname,
                                                     PerfData::U_None, CHECK);
@@ -66,6 +72,19 @@ ShenandoahHeapRegionCounters::ShenandoahHeapRegionCounters() :
       _regions_data[i] = PerfDataManager::create_long_variable(SUN_GC, data_name,
                                                                PerfData::U_None, CHECK);
     }
+
+    uint num_nodes = ShenandoahNUMA::count();
+    _nodes_used = NEW_C_HEAP_ARRAY(PerfVariable*, num_nodes, mtGC);
+    _nodes_free = NEW_C_HEAP_ARRAY(PerfVariable*, num_nodes, mtGC);
+    for (uint n = 0; n < num_nodes; n++) {
+      const char* node_name = PerfDataManager::name_space(_name_space, "node", n);
+      const char* used_name = PerfDataManager::counter_name(node_name, "used");
+      _nodes_used[n] = PerfDataManager::create_long_variable(SUN_GC, used_name,
+                                                             PerfData::U_None, CHECK);
+      const char* free_name = PerfDataManager::counter_name(node_name, "free");
+      _nodes_free[n] = PerfDataManager::create_long_variable(SUN_GC, free_name,
+                                                             PerfData::U_None, CHECK);
+    }
   }
 }
 
@@ -94,6 +113,17 @@ void ShenandoahHeapRegionCounters::update() {
       {
         ShenandoahHeapLocker locker(heap->lock());
         size_t rs = ShenandoahHeapRegion::region_size_bytes();
+        for (uint n = 0; n < ShenandoahNUMA::count(); n++) {
+          size_t used = 0;
+          size_t free = 0;
+          for (size_t i = ShenandoahNUMA::first_region(n); i < ShenandoahNUMA::first_region(n + 1); i++) {
+            ShenandoahHeapRegion* r = heap->get_region(i);
+            used += r->used();
+            free += r->free();
+          }
+          _nodes_used[n]->set_value((jlong)(used >> 10));
+          _nodes_free[n]->set_value((jlong)(free >> 10));
+        }
         for (uint i = 0; i < num_regions; i++) {
           ShenandoahHeapRegion* r = heap->get_region(i);
           jlong data = 0;
@@ -102,6 +132,7 @@ void ShenandoahHeapRegionCounters::update() {
           data |= ((100 * r->get_tlab_allocs() / rs)     & PERCENT_MASK) << TLAB_SHIFT;
           data |= ((100 * r->get_gclab_allocs() / rs)    & PERCENT_MASK) << GCLAB_SHIFT;
           data |= ((100 * r->get_shared_allocs() / rs)   & PERCENT_MASK) << SHARED_SHIFT;
+          data |= (ShenandoahNUMA::index_of_region(i)    & NODE_MASK)    << NODE_SHIFT;
           data |= (r->state_ordinal() & STATUS_MASK) << STATUS_SHIFT;
           _regions_data[i]->set_value(data);
         }
@@ -34,6 +34,7 @@
  * - sun.gc.shenandoah.regions.timestamp    the timestamp for this sample
  * - sun.gc.shenandoah.regions.max_regions  maximum number of regions
  * - sun.gc.shenandoah.regions.region_size  size per region, in kilobytes
+ * - sun.gc.shenandoah.regions.numa_nodes   number of NUMA nodes the heap is split into
  *
  * variables:
  * - sun.gc.shenandoah.regions.status       current GC status:
@@ -41,6 +42,11 @@
  *     - bit 1 set when evacuation in progress
  *     - bit 2 set when update refs in progress
  *
+ * two variable counters per NUMA node, with $numa_nodes (see above) counters:
+ * - sun.gc.shenandoah.regions.node.$n.used      used memory on the node, in kilobytes
+ * - sun.gc.shenandoah.regions.node.$n.free      free memory on the node, in kilobytes
+ * where $n is the node index 0 <= n < $numa_nodes
+ *
  * two variable counters per region, with $max_regions (see above) counters:
  * - sun.gc.shenandoah.regions.region.$i.data
  * where $ is the region number from 0 <= i < $max_regions
@@ -51,7 +57,7 @@
  * - bits 14-20  tlab allocated memory in percent
  * - bits 21-27  gclab allocated memory in percent
  * - bits 28-34  shared allocated memory in percent
- * - bits 35-41  <reserved>
+ * - bits 35-41  NUMA node index
  * - bits 42-50  <reserved>
  * - bits 51-57  <reserved>
  * - bits 58-63  status
@@ -61,17 +67,21 @@ class ShenandoahHeapRegionCounters : public CHeapObj<mtGC>  {
 private:
   static const jlong PERCENT_MASK = 0x7f;
   static const jlong STATUS_MASK  = 0x3f;
+  static const jlong NODE_MASK    = 0x7f;
 
   static const jlong USED_SHIFT   = 0;
   static const jlong LIVE_SHIFT   = 7;
   static const jlong TLAB_SHIFT   = 14;
   static const jlong GCLAB_SHIFT  = 21;
   static const jlong SHARED_SHIFT = 28;
+  static const jlong NODE_SHIFT   = 35;
 
   static const jlong STATUS_SHIFT = 58;
 
   char* _name_space;
   PerfLongVariable** _regions_data;
+  PerfLongVariable** _nodes_used;
+  PerfLongVariable** _nodes_free;
   PerfLongVariable* _timestamp;
   PerfLongVariable* _status;
   volatile jlong _last_sample_millis;
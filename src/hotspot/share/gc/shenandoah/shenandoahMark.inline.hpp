@@ -38,6 +38,7 @@
 #include "gc/shenandoah/shenandoahUtils.hpp"
 #include "memory/iterator.inline.hpp"
 #include "oops/compressedOops.inline.hpp"
+#include "oops/instanceKlass.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "utilities/devirtualizer.inline.hpp"
@@ -80,10 +81,12 @@ void ShenandoahMark::do_task(ShenandoahObjToScanQueue* q, T* cl, ShenandoahLiveD
 
       obj->oop_iterate(cl);
       dedup_string<STRING_DEDUP>(obj, req);
+      record_references(obj);
     } else if (obj->is_objArray()) {
       // Case 2: Object array instance and no chunk is set. Must be the first
       // time we visit it, start the chunked processing.
       do_chunked_array_start<T>(q, cl, obj, weak);
+      record_references(obj);
     } else {
       // Case 3: Primitive array. Do nothing, no oops there. We use the same
       // performance tweak TypeArrayKlass::oop_oop_iterate_impl is using:
@@ -103,6 +106,28 @@ void ShenandoahMark::do_task(ShenandoahObjToScanQueue* q, T* cl, ShenandoahLiveD
   }
 }
 
+inline void ShenandoahMark::record_references(oop obj) {
+  ShenandoahHeap* const heap = ShenandoahHeap::heap();
+  ShenandoahHeapRegion* region = heap->heap_region_containing(obj);
+  if (region->has_references()) {
+    return;
+  }
+  // Plain instances without oop maps (boxed primitives and the like) hold no references.
+  // Special instance kinds carry hidden references and always count.
+  Klass* k = obj->klass();
+  if (k->is_other_instance_klass() && InstanceKlass::cast(k)->nonstatic_oop_map_count() == 0) {
+    return;
+  }
+  region->set_has_references();
+  if (region->is_humongous_start()) {
+    // Update references visits humongous continuations on their own
+    size_t num_regions = ShenandoahHeapRegion::required_regions(obj->size() * HeapWordSize);
+    for (size_t i = region->index() + 1; i < region->index() + num_regions; i++) {
+      heap->get_region(i)->set_has_references();
+    }
+  }
+}
+
 template <ShenandoahGenerationType GENERATION>
 inline void ShenandoahMark::count_liveness(ShenandoahLiveData* live_data, oop obj) {
   ShenandoahHeap* const heap = ShenandoahHeap::heap();
@@ -30,6 +30,9 @@
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegionCounters.hpp"
 #include "memory/metaspaceCounters.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/perfData.inline.hpp"
 #include "services/memoryService.hpp"
 
 class ShenandoahYoungGenerationCounters : public GenerationCounters {
@@ -59,7 +62,11 @@ class ShenandoahGenerationCounters : public GenerationCounters {
 ShenandoahMonitoringSupport::ShenandoahMonitoringSupport(ShenandoahHeap* heap) :
         _partial_counters(nullptr),
         _full_counters(nullptr),
-        _counters_update_task(this)
+        _counters_update_task(this),
+        _gclab_denied(0),
+        _evac_oom(0),
+        _gclab_denied_counter(nullptr),
+        _evac_oom_counter(nullptr)
 {
   // Collection counters do not fit Shenandoah very well.
   // We record partial cycles as "young", and full cycles (including full STW GC) as "old".
@@ -73,6 +80,16 @@ ShenandoahMonitoringSupport::ShenandoahMonitoringSupport(ShenandoahHeap* heap) :
 
   _heap_region_counters = new ShenandoahHeapRegionCounters();
 
+  if (UsePerfData) {
+    EXCEPTION_MARK;
+    ResourceMark rm;
+    const char* ns = PerfDataManager::name_space("shenandoah", "evacuation");
+    const char* cname = PerfDataManager::counter_name(ns, "gclabDenied");
+    _gclab_denied_counter = PerfDataManager::create_long_variable(SUN_GC, cname, PerfData::U_Events, CHECK);
+    cname = PerfDataManager::counter_name(ns, "oomDuringEvac");
+    _evac_oom_counter = PerfDataManager::create_long_variable(SUN_GC, cname, PerfData::U_Events, CHECK);
+  }
+
   _counters_update_task.enroll();
 }
 
@@ -92,6 +109,14 @@ CollectorCounters* ShenandoahMonitoringSupport::partial_collection_counters() {
   return _partial_counters;
 }
 
+void ShenandoahMonitoringSupport::record_gclab_denied() {
+  Atomic::inc(&_gclab_denied);
+}
+
+void ShenandoahMonitoringSupport::record_evac_oom() {
+  Atomic::inc(&_evac_oom);
+}
+
 void ShenandoahMonitoringSupport::update_counters() {
   MemoryService::track_memory_usage();
 
@@ -102,6 +127,8 @@ void ShenandoahMonitoringSupport::update_counters() {
     _heap_counters->update_all();
     _space_counters->update_all(capacity, used);
     _heap_region_counters->update();
+    _gclab_denied_counter->set_value(Atomic::load(&_gclab_denied));
+    _evac_oom_counter->set_value(Atomic::load(&_evac_oom));
 
     MetaspaceCounters::update_performance_counters();
   }
@@ -27,6 +27,7 @@
 
 #include "gc/shenandoah/shenandoahSharedVariables.hpp"
 #include "memory/allocation.hpp"
+#include "runtime/perfDataTypes.hpp"
 #include "runtime/task.hpp"
 
 class GenerationCounters;
@@ -68,6 +69,12 @@ class ShenandoahMonitoringSupport : public CHeapObj<mtGC> {
   ShenandoahHeapRegionCounters* _heap_region_counters;
   ShenandoahPeriodicCountersUpdateTask _counters_update_task;
 
+  // Evacuation headroom usage, published with the other counters
+  volatile size_t _gclab_denied;
+  volatile size_t _evac_oom;
+  PerfVariable* _gclab_denied_counter;
+  PerfVariable* _evac_oom_counter;
+
 public:
   explicit ShenandoahMonitoringSupport(ShenandoahHeap* heap);
   CollectorCounters* stw_collection_counters();
@@ -79,6 +86,11 @@ class ShenandoahMonitoringSupport : public CHeapObj<mtGC> {
   void set_forced_counters_update(bool value);
   void handle_force_counters_update();
 
+  // GCLAB refill refused to keep the evacuation headroom for shared evacuations
+  void record_gclab_denied();
+  // Evacuation failed even with the headroom, and took the OOM-during-evac protocol
+  void record_evac_oom();
+
   void update_counters();
 };
 
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shenandoah/shenandoahNUMA.hpp"
+#include "logging/log.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+
+uint   ShenandoahNUMA::_count = 1;
+uint*  ShenandoahNUMA::_node_ids = nullptr;
+uint*  ShenandoahNUMA::_node_id_to_index = nullptr;
+uint   ShenandoahNUMA::_len_node_id_to_index = 0;
+size_t ShenandoahNUMA::_num_regions = 1;
+
+void ShenandoahNUMA::initialize(size_t num_regions, size_t region_size, size_t page_size) {
+  _num_regions = num_regions;
+
+  if (!UseNUMA) {
+    return;
+  }
+
+  if (page_size > region_size) {
+    // Cannot bind the memory at region granularity.
+    log_info(gc, init)("NUMA: Disabled, page size (" SIZE_FORMAT "%s) is larger than region size (" SIZE_FORMAT "%s)",
+                       byte_size_in_proper_unit(page_size),   proper_unit_for_byte_size(page_size),
+                       byte_size_in_proper_unit(region_size), proper_unit_for_byte_size(region_size));
+    return;
+  }
+
+  size_t num_node_ids = os::numa_get_groups_num();
+  _node_ids = NEW_C_HEAP_ARRAY(uint, num_node_ids, mtGC);
+  uint count = checked_cast<uint>(os::numa_get_leaf_groups(_node_ids, num_node_ids));
+
+  // Every node should get at least one region.
+  count = (uint)MIN2<size_t>(count, num_regions);
+  if (count <= 1) {
+    return;
+  }
+
+  uint max_node_id = 0;
+  for (uint i = 0; i < count; i++) {
+    max_node_id = MAX2(max_node_id, _node_ids[i]);
+  }
+
+  // Unknown node ids are mapped to the first node.
+  _len_node_id_to_index = max_node_id + 1;
+  _node_id_to_index = NEW_C_HEAP_ARRAY(uint, _len_node_id_to_index, mtGC);
+  for (uint i = 0; i < _len_node_id_to_index; i++) {
+    _node_id_to_index[i] = 0;
+  }
+  for (uint i = 0; i < count; i++) {
+    _node_id_to_index[_node_ids[i]] = i;
+  }
+
+  _count = count;
+
+  log_info(gc, init)("NUMA: %u nodes, " SIZE_FORMAT " regions per node", _count, _num_regions / _count);
+}
+
+uint ShenandoahNUMA::index_of_current_thread() {
+  if (!is_enabled()) {
+    return 0;
+  }
+
+  int node_id = os::numa_get_group_id();
+  if (node_id < 0 || (uint)node_id >= _len_node_id_to_index) {
+    return 0;
+  }
+  return _node_id_to_index[node_id];
+}
+
+void ShenandoahNUMA::request_memory_on_node(void* addr, size_t bytes, size_t region_idx) {
+  if (!is_enabled()) {
+    return;
+  }
+
+  uint index = index_of_region(region_idx);
+  os::numa_make_local((char*)addr, bytes, checked_cast<int>(_node_ids[index]));
+}
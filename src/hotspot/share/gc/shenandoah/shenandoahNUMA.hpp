@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHENANDOAH_SHENANDOAHNUMA_HPP
+#define SHARE_GC_SHENANDOAH_SHENANDOAHNUMA_HPP
+
+#include "memory/allStatic.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+/**
+ * ShenandoahNUMA splits the heap into contiguous ranges of regions, one per NUMA node,
+ * and binds the memory of each range to its node. Free set uses the ranges to satisfy
+ * LAB and shared allocations from the node of the allocating thread.
+ *
+ * Without NUMA, or on a single node machine, there is exactly one node that spans
+ * the entire heap.
+ */
+class ShenandoahNUMA : public AllStatic {
+private:
+  static uint   _count;
+  static uint*  _node_ids;
+  static uint*  _node_id_to_index;
+  static uint   _len_node_id_to_index;
+  static size_t _num_regions;
+
+public:
+  static void initialize(size_t num_regions, size_t region_size, size_t page_size);
+
+  static bool is_enabled() { return _count > 1; }
+
+  // Number of nodes the heap is split into
+  static uint count() { return _count; }
+
+  // Node index of the current thread
+  static uint index_of_current_thread();
+
+  // Node index the region is bound to
+  static uint index_of_region(size_t region_idx) {
+    return (uint)(region_idx * _count / _num_regions);
+  }
+
+  // Node index owns regions [first_region(index), first_region(index + 1))
+  static size_t first_region(uint index) {
+    return (index * _num_regions + _count - 1) / _count;
+  }
+
+  // Bind the memory of the committed region to its node
+  static void request_memory_on_node(void* addr, size_t bytes, size_t region_idx);
+};
+
+#endif // SHARE_GC_SHENANDOAH_SHENANDOAHNUMA_HPP
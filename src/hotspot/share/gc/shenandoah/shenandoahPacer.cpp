@@ -24,13 +24,18 @@
 
 #include "precompiled.hpp"
 
+#include "gc/shenandoah/shenandoahCollectionSet.inline.hpp"
+#include "gc/shenandoah/shenandoahEvacOOMHandler.inline.hpp"
 #include "gc/shenandoah/shenandoahFreeSet.hpp"
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
+#include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
 #include "gc/shenandoah/shenandoahPacer.hpp"
 #include "gc/shenandoah/shenandoahPhaseTimings.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/javaThread.inline.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/safepointMechanism.inline.hpp"
 #include "runtime/threadSMR.hpp"
 
 /*
@@ -96,6 +101,11 @@ void ShenandoahPacer::setup_for_evac() {
 
   restart_with(non_taxable, tax);
 
+  // Paced threads walk the heap from the top down, meeting the workers
+  // that claim collection set regions from the bottom up.
+  Atomic::store(&_assist_cursor, _heap->num_regions() << ShenandoahHeapRegion::region_size_words_shift());
+  _assist_enabled.set();
+
   log_info(gc, ergo)("Pacer for Evacuation. Used CSet: " SIZE_FORMAT "%s, Free: " SIZE_FORMAT "%s, "
                      "Non-Taxable: " SIZE_FORMAT "%s, Alloc Tax Rate: %.1fx",
                      byte_size_in_proper_unit(used),        proper_unit_for_byte_size(used),
@@ -184,6 +194,7 @@ void ShenandoahPacer::restart_with(size_t non_taxable_bytes, double tax_rate) {
   Atomic::xchg(&_budget, (intptr_t)initial, memory_order_relaxed);
   Atomic::store(&_tax_rate, tax_rate);
   Atomic::inc(&_epoch);
+  _assist_enabled.unset();
 
   // Shake up stalled waiters after budget update.
   _need_notify_waiters.try_set();
@@ -257,8 +268,22 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
   size_t max_ms = ShenandoahPacingMaxDelay;
   size_t total_ms = 0;
 
+  if (ShenandoahPacingAssist && _assist_enabled.is_set()) {
+    // Pay the tax with our own evacuation work first. The budget stays
+    // overdrawn, so the following allocations would assist as well,
+    // until workers replenish it. The assist shares the delay budget
+    // with the wait below.
+    double deadline = start + (double)max_ms / MILLIUNITS;
+    if (assist_for_alloc(words, deadline) || Atomic::load(&_budget) >= 0) {
+      return;
+    }
+    total_ms = (size_t)((os::elapsedTime() - start) * 1000);
+    if (total_ms >= max_ms) {
+      return;
+    }
+  }
+
   while (true) {
-    // We could instead assist GC, but this would suffice for now.
     size_t cur_ms = (max_ms > total_ms) ? (max_ms - total_ms) : 1;
     wait(cur_ms);
 
@@ -277,6 +302,106 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
   }
 }
 
+bool ShenandoahPacer::assist_for_alloc(size_t words, double deadline) {
+  EventShenandoahAllocationAssist event;
+
+  double start = os::elapsedTime();
+  // Cap the tax at a region worth of evacuation, a single large allocation
+  // should not make its thread evacuate a large part of the collection set.
+  size_t tax = clamp<size_t>((size_t)(words * Atomic::load(&_tax_rate)),
+                             1, ShenandoahHeapRegion::region_size_words());
+  size_t assisted = assist_evacuation(tax, deadline);
+  ShenandoahThreadLocalData::add_assist_time(JavaThread::current(), os::elapsedTime() - start);
+
+  if (assisted > 0) {
+    event.commit(words * HeapWordSize, assisted * HeapWordSize);
+  }
+
+  return assisted >= tax;
+}
+
+size_t ShenandoahPacer::assist_evacuation(size_t words, double deadline) {
+  // Do not bother claiming tiny spans, larger chunks amortize the contention
+  // on the cursor and the evac OOM protocol.
+  static const size_t min_chunk_words = 4 * K;
+
+  ShenandoahCollectionSet* const cset = _heap->collection_set();
+  ShenandoahMarkingContext* const ctx = _heap->complete_marking_context();
+  HeapWord* const base = _heap->base();
+  JavaThread* const thread = JavaThread::current();
+
+  ShenandoahEvacOOMScope oom_evac_scope(thread);
+
+  size_t assisted = 0;
+  while (assisted < words) {
+    // Do not hold up safepoints or handshakes, and give up when the delay
+    // budget is spent. Checked between chunks, which the capped tax bounds.
+    if (!_assist_enabled.is_set() ||
+        !_heap->is_evacuation_in_progress() ||
+        _heap->cancelled_gc() ||
+        ShenandoahThreadLocalData::is_oom_during_evac(thread) ||
+        SafepointMechanism::should_process(thread, false /* allow_suspend */) ||
+        os::elapsedTime() >= deadline) {
+      break;
+    }
+
+    size_t cur = Atomic::load(&_assist_cursor);
+    if (cur == 0) {
+      // Walked the entire heap.
+      break;
+    }
+
+    size_t index = (cur - 1) >> ShenandoahHeapRegion::region_size_words_shift();
+    if (index < cset->claimed_index()) {
+      // Workers have claimed all remaining regions, there is nothing to help with.
+      break;
+    }
+
+    ShenandoahHeapRegion* r = _heap->get_region(index);
+    size_t bottom = index << ShenandoahHeapRegion::region_size_words_shift();
+    size_t top = bottom + pointer_delta(r->top(), r->bottom());
+
+    size_t next;
+    if (!cset->is_in(index)) {
+      next = bottom;
+    } else if (cur > top) {
+      next = top;
+    } else {
+      size_t chunk = MAX2(words - assisted, min_chunk_words);
+      next = (cur - bottom > chunk) ? cur - chunk : bottom;
+    }
+
+    if (Atomic::cmpxchg(&_assist_cursor, cur, next, memory_order_relaxed) != cur) {
+      // Somebody else moved the cursor, retry from there.
+      continue;
+    }
+
+    if (!cset->is_in(index) || cur > top) {
+      continue;
+    }
+
+    // Evacuate the marked objects that start in the claimed span. Objects past
+    // TAMS are left for the workers, which walk them by size.
+    HeapWord* limit = MIN2(base + cur, ctx->top_at_mark_start(r));
+    HeapWord* cb = base + next;
+    while (cb < limit) {
+      cb = ctx->get_next_marked_addr(cb, limit);
+      if (cb >= limit) {
+        break;
+      }
+      oop obj = cast_to_oop(cb);
+      if (!obj->is_forwarded()) {
+        _heap->evacuate_object(obj, thread);
+      }
+      cb++;
+    }
+
+    assisted += cur - next;
+  }
+
+  return assisted;
+}
+
 void ShenandoahPacer::wait(size_t time_ms) {
   // Perform timed wait. It works like like sleep(), except without modifying
   // the thread interruptible status. MonitorLocker also checks for safepoints.
@@ -295,10 +420,13 @@ void ShenandoahPacer::notify_waiters() {
 
 void ShenandoahPacer::flush_stats_to_cycle() {
   double sum = 0;
+  double assist_sum = 0;
   for (JavaThreadIteratorWithHandle jtiwh; JavaThread *t = jtiwh.next(); ) {
     sum += ShenandoahThreadLocalData::paced_time(t);
+    assist_sum += ShenandoahThreadLocalData::assist_time(t);
   }
   ShenandoahHeap::heap()->phase_timings()->record_phase_time(ShenandoahPhaseTimings::pacing, sum);
+  ShenandoahHeap::heap()->phase_timings()->record_phase_time(ShenandoahPhaseTimings::pacing_assist, assist_sum);
 }
 
 void ShenandoahPacer::print_cycle_on(outputStream* out) {
@@ -337,6 +465,24 @@ void ShenandoahPacer::print_cycle_on(outputStream* out) {
             sum / threads_nz * 1000, total * 1000, sum / threads_nz / total * 100);
   }
   out->cr();
+
+  if (ShenandoahPacingAssist) {
+    out->print_cr("Allocation pacing assist accrued:");
+
+    double assist_sum = 0;
+    for (JavaThreadIteratorWithHandle jtiwh; JavaThread *t = jtiwh.next(); ) {
+      double d = ShenandoahThreadLocalData::assist_time(t);
+      if (d > 0) {
+        assist_sum += d;
+        out->print_cr("  %5.0f of %5.0f ms (%5.1f%%): %s",
+                d * 1000, total * 1000, d/total*100, t->name());
+      }
+      ShenandoahThreadLocalData::reset_assist_time(t);
+    }
+    out->print_cr("  %5.0f of %5.0f ms (%5.1f%%): <total>",
+            assist_sum * 1000, total * 1000, assist_sum/total*100);
+    out->cr();
+  }
 }
 
 void ShenandoahPeriodicPacerNotifyTask::task() {
@@ -56,6 +56,9 @@ class ShenandoahPeriodicPacerNotifyTask : public PeriodicTask {
  *
  * Currently it implements simple tax-and-spend pacing policy: GC threads provide
  * credit, allocating thread spend the credit, or stall when credit is not available.
+ * During evacuation, allocating threads that are out of credit first pay their tax
+ * by evacuating a part of collection set themselves, and only stall if there is no
+ * work left for them to do.
  */
 class ShenandoahPacer : public CHeapObj<mtGC> {
 private:
@@ -80,6 +83,14 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
   volatile intptr_t _progress;
   shenandoah_padding(3);
 
+  // Set once per phase
+  ShenandoahSharedFlag _assist_enabled;
+
+  // Heavily updated, protect from accidental false sharing
+  shenandoah_padding(4);
+  volatile size_t _assist_cursor;
+  shenandoah_padding(5);
+
 public:
   explicit ShenandoahPacer(ShenandoahHeap* heap) :
           _heap(heap),
@@ -90,7 +101,8 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
           _epoch(0),
           _tax_rate(1),
           _budget(0),
-          _progress(PACING_PROGRESS_UNINIT) {
+          _progress(PACING_PROGRESS_UNINIT),
+          _assist_cursor(0) {
     _notify_waiters_task.enroll();
   }
 
@@ -127,6 +139,9 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
 
   size_t update_and_get_progress_history();
 
+  size_t assist_evacuation(size_t words, double deadline);
+  bool assist_for_alloc(size_t words, double deadline);
+
   void wait(size_t time_ms);
 };
 
@@ -115,6 +115,7 @@ bool ShenandoahPhaseTimings::is_worker_phase(Phase phase) {
     case conc_mark_roots:
     case conc_thread_roots:
     case conc_weak_roots_work:
+    case conc_class_unload_unlink_code_roots:
     case conc_weak_refs:
     case conc_strong_roots:
       return true;
@@ -283,6 +284,10 @@ void ShenandoahPhaseTimings::print_global_on(outputStream* out) const {
   out->print_cr("  Raise max pacing delay with care.");
   out->cr();
 
+  out->print_cr("  Pacing assist is the time paced threads spent evacuating the collection set themselves,");
+  out->print_cr("  instead of waiting for GC progress. It is accounted separately from pacing delays.");
+  out->cr();
+
   for (uint i = 0; i < _num_phases; i++) {
     if (_global_data[i].maximum() != 0) {
       out->print_cr(SHENANDOAH_PHASE_NAME_FORMAT " = " SHENANDOAH_S_TIME_FORMAT " s "
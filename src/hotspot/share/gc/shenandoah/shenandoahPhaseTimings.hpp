@@ -87,9 +87,12 @@ class outputStream;
   f(conc_class_unload_unlink_sd,                    "    System Dictionary")           \
   f(conc_class_unload_unlink_weak_klass,            "    Weak Class Links")            \
   f(conc_class_unload_unlink_code_roots,            "    Code Roots")                  \
+  SHENANDOAH_PAR_PHASE_DO(conc_class_unload_unlink_code_roots_, "      CU: ", f)       \
   f(conc_class_unload_rendezvous,                   "  Rendezvous")                    \
   f(conc_class_unload_purge,                        "  Purge Unlinked")                \
   f(conc_class_unload_purge_coderoots,              "    Code Roots")                  \
+  f(conc_class_unload_purge_coderoots_unregister,   "      Unregister")                \
+  f(conc_class_unload_purge_coderoots_free,         "      Free")                      \
   f(conc_class_unload_purge_cldg,                   "    CLDG")                        \
   f(conc_class_unload_purge_ec,                     "    Exception Caches")            \
   f(conc_strong_roots,                              "Concurrent Strong Roots")         \
@@ -175,6 +178,7 @@ class outputStream;
                                                                                        \
   f(conc_uncommit,                                  "Concurrent Uncommit")             \
   f(pacing,                                         "Pacing")                          \
+  f(pacing_assist,                                  "Pacing Assist")                   \
                                                                                        \
   f(heap_iteration_roots,                           "Heap Iteration")                  \
   SHENANDOAH_PAR_PHASE_DO(heap_iteration_roots_,    "  HI: ", f)                       \
@@ -230,6 +234,13 @@ class ShenandoahPhaseTimings : public CHeapObj<mtGC> {
   void flush_par_workers_to_cycle();
   void flush_cycle_to_global();
 
+  // Time recorded for the phase in the current cycle, zero if the phase has not happened.
+  double cycle_time(Phase phase) const {
+    assert(phase >= 0 && phase < _num_phases, "Out of bound");
+    double t = _cycle_data[phase];
+    return (t == uninitialized()) ? 0 : t;
+  }
+
   static const char* phase_name(Phase phase) {
     assert(phase >= 0 && phase < _num_phases, "Out of bound");
     return _phase_names[phase];
@@ -45,6 +45,7 @@ class ShenandoahThreadLocalData {
   PLAB* _gclab;
   size_t _gclab_size;
   double _paced_time;
+  double _assist_time;
 
   ShenandoahThreadLocalData() :
     _gc_state(0),
@@ -53,7 +54,8 @@ class ShenandoahThreadLocalData {
     _satb_mark_queue(&ShenandoahBarrierSet::satb_mark_queue_set()),
     _gclab(nullptr),
     _gclab_size(0),
-    _paced_time(0) {
+    _paced_time(0),
+    _assist_time(0) {
   }
 
   ~ShenandoahThreadLocalData() {
@@ -124,6 +126,18 @@ class ShenandoahThreadLocalData {
     data(thread)->_paced_time = 0;
   }
 
+  static void add_assist_time(Thread* thread, double v) {
+    data(thread)->_assist_time += v;
+  }
+
+  static double assist_time(Thread* thread) {
+    return data(thread)->_assist_time;
+  }
+
+  static void reset_assist_time(Thread* thread) {
+    data(thread)->_assist_time = 0;
+  }
+
   // Evacuation OOM handling
   static bool is_oom_during_evac(Thread* thread) {
     return data(thread)->_oom_during_evac;
@@ -159,7 +159,8 @@ void ShenandoahUnload::unload() {
 
     {
       ShenandoahTimingsTracker t(ShenandoahPhaseTimings::conc_class_unload_unlink_code_roots);
-      ShenandoahCodeRoots::unlink(heap->workers(), unloadingOccurred);
+      ShenandoahCodeRoots::unlink(heap->workers(), unloadingOccurred,
+                                  ShenandoahPhaseTimings::conc_class_unload_unlink_code_roots);
     }
 
     DependencyContext::cleaning_end();
@@ -73,7 +73,9 @@
           " static -  trigger GC when free heap falls below the threshold;" \
           " aggressive - run GC continuously, try to evacuate everything;"  \
           " compact - run GC more frequently and with deeper targets to "   \
-          "free up more memory.")                                           \
+          "free up more memory;"                                            \
+          " predictive - like adaptive, but predict the time of each "      \
+          "concurrent phase separately (experimental).")                    \
                                                                             \
   product(uintx, ShenandoahGarbageThreshold, 25, EXPERIMENTAL,              \
           "How much garbage a region has to contain before it would be "    \
@@ -149,6 +151,13 @@
           "Larger values give more weight to recent values.")               \
           range(0,1.0)                                                      \
                                                                             \
+  product(uintx, ShenandoahPredictiveMargin, 10, EXPERIMENTAL,              \
+          "How much longer than predicted the cycle is allowed to take "    \
+          "before allocations would deplete the free headroom, in percent " \
+          "of the predicted cycle time. Larger values start cycles "        \
+          "earlier. Applies to predictive heuristics only.")                \
+          range(0,1000)                                                     \
+                                                                            \
   product(uintx, ShenandoahGuaranteedGCInterval, 5*60*1000, EXPERIMENTAL,   \
           "Many heuristics would guarantee a concurrent GC cycle at "       \
           "least with this interval. This is useful when large idle "       \
@@ -234,6 +243,14 @@
           "reserve/waste is incorrect, at the risk that application "       \
           "runs out of memory too early.")                                  \
                                                                             \
+  product(uintx, ShenandoahEvacOOMHeadroom, 5, EXPERIMENTAL,                \
+          "How much of the evacuation reserve to keep away from GCLAB "     \
+          "refills. The headroom is used by shared evacuation allocations " \
+          "only, which makes running out of memory during evacuation, "     \
+          "with the expensive handshake it requires, less likely. "         \
+          "In percents of the evacuation reserve.")                         \
+          range(0,100)                                                      \
+                                                                            \
   product(bool, ShenandoahPacing, true, EXPERIMENTAL,                       \
           "Pace application allocations to give GC chance to start "        \
           "and complete before allocation failure is reached.")             \
@@ -268,6 +285,12 @@
           "the beginning of it.")                                           \
           range(1.0, 100.0)                                                 \
                                                                             \
+  product(bool, ShenandoahPacingAssist, false, EXPERIMENTAL,                \
+          "Make allocating threads that ran out of pacing budget during "   \
+          "evacuation evacuate a part of collection set themselves, in "    \
+          "proportion to their allocation, before resorting to waiting "    \
+          "for GC progress.")                                               \
+                                                                            \
   product(uintx, ShenandoahCriticalFreeThreshold, 1, EXPERIMENTAL,          \
           "How much of the heap needs to be free after recovery cycles, "   \
           "either Degenerated or Full GC to be claimed successful. If this "\
@@ -322,6 +345,10 @@
           "How many regions to process at once during parallel region "     \
           "iteration. Affects heaps with lots of regions.")                 \
                                                                             \
+  product(bool, ShenandoahUpdateRefsSkipRefFree, true, DIAGNOSTIC,          \
+          "Skip regions during update references when marking found no "    \
+          "objects holding references in them.")                            \
+                                                                            \
   product(size_t, ShenandoahSATBBufferSize, 1 * K, EXPERIMENTAL,            \
           "Number of entries in an SATB log buffer.")                       \
           range(1, max_uintx)                                               \
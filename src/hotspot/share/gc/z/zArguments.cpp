@@ -126,6 +126,21 @@ void ZArguments::initialize() {
     FLAG_SET_DEFAULT(ZMarkStackSpaceLimit, mark_stack_space_limit);
   }
 
+  // Check mark stack spill size
+  if (ZMarkStackSpillLimit > mark_stack_space_limit - ZMarkStackSpaceLimit) {
+    if (!FLAG_IS_DEFAULT(ZMarkStackSpillLimit)) {
+      vm_exit_during_initialization("ZMarkStackSpillLimit too large for limited address space");
+    }
+    FLAG_SET_DEFAULT(ZMarkStackSpillLimit, mark_stack_space_limit - ZMarkStackSpaceLimit);
+  }
+
+#ifndef LINUX
+  if (ZReserveLargePages) {
+    warning("ZReserveLargePages is only supported on Linux");
+    FLAG_SET_DEFAULT(ZReserveLargePages, false);
+  }
+#endif
+
   // Enable NUMA by default
   if (FLAG_IS_DEFAULT(UseNUMA)) {
     FLAG_SET_DEFAULT(UseNUMA, true);
@@ -32,6 +32,11 @@
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "logging/log.hpp"
+#include "utilities/align.hpp"
+#include "utilities/macros.hpp"
+#ifdef LINUX
+#include "osContainer_linux.hpp"
+#endif
 
 ZDirector* ZDirector::_director;
 
@@ -48,6 +53,7 @@ struct ZDirectorHeapStats {
   size_t _soft_max_heap_size;
   size_t _used;
   uint   _total_collections;
+  bool   _memory_pressure_limited;
 };
 
 struct ZDirectorGenerationGeneralStats {
@@ -72,7 +78,9 @@ struct ZDirectorStats {
 
 ZDirector::ZDirector()
   : _monitor(),
-    _stopped(false) {
+    _stopped(false),
+    _memory_pressure_ticks(0),
+    _under_memory_pressure(false) {
   _director = this;
   set_name("ZDirector");
   create_and_start();
@@ -596,6 +604,28 @@ static bool rule_major_proactive(const ZDirectorStats& stats) {
   return time_until_gc <= 0;
 }
 
+static bool rule_major_memory_pressure(const ZDirectorStats& stats) {
+  if (ZMemoryPressureThreshold == 0.0 || !stats._heap._memory_pressure_limited) {
+    // Rule disabled
+    return false;
+  }
+
+  // Perform GC if heap usage has reached the soft max capacity, lowered due
+  // to container memory pressure, so that garbage is reclaimed and the freed
+  // memory can be uncommitted. To avoid back-to-back collections, we spend at
+  // most ~20% of the time collecting due to this rule.
+  const size_t soft_max_capacity = stats._heap._soft_max_heap_size;
+  const size_t used = stats._heap._used;
+  const double gc_duration = gc_time(stats._young_stats) + gc_time(stats._old_stats);
+  const double time_since_last_gc = stats._old_stats._cycle._time_since_last;
+  const double time_until_gc = (gc_duration * 4.0) - time_since_last_gc;
+
+  log_debug(gc, director)("Rule Major: Memory Pressure, Used: " SIZE_FORMAT "MB, SoftMaxCapacity: " SIZE_FORMAT "MB, "
+                          "TimeUntilGC: %.3fs", used / M, soft_max_capacity / M, time_until_gc);
+
+  return used >= soft_max_capacity && time_until_gc <= 0;
+}
+
 static GCCause::Cause make_minor_gc_decision(const ZDirectorStats& stats) {
   if (ZDriver::minor()->is_busy()) {
     return GCCause::_no_gc;
@@ -633,6 +663,10 @@ static GCCause::Cause make_major_gc_decision(const ZDirectorStats& stats) {
     return GCCause::_z_warmup;
   }
 
+  if (rule_major_memory_pressure(stats)) {
+    return GCCause::_z_memory_pressure;
+  }
+
   if (rule_major_proactive(stats)) {
     return GCCause::_z_proactive;
   }
@@ -855,10 +889,13 @@ bool ZDirector::wait_for_tick() {
 static ZDirectorHeapStats sample_heap_stats() {
   const ZHeap* const heap = ZHeap::heap();
   const ZCollectedHeap* const collected_heap = ZCollectedHeap::heap();
+  const size_t soft_max_capacity = heap->soft_max_capacity();
+  const size_t memory_pressure_max_capacity = heap->memory_pressure_max_capacity();
   return {
-    heap->soft_max_capacity(),
+    soft_max_capacity,
     heap->used(),
-    collected_heap->total_collections()
+    collected_heap->total_collections(),
+    memory_pressure_max_capacity <= soft_max_capacity && memory_pressure_max_capacity < heap->max_capacity()
   };
 }
 
@@ -905,10 +942,92 @@ static ZDirectorStats sample_stats() {
   };
 }
 
+static double container_memory_pressure() {
+#ifdef LINUX
+  if (OSContainer::is_containerized()) {
+    return OSContainer::memory_pressure();
+  }
+#endif
+  return -1.0;
+}
+
+static size_t container_memory_headroom() {
+#ifdef LINUX
+  if (OSContainer::is_containerized()) {
+    const jlong limit = OSContainer::memory_limit_in_bytes();
+    const jlong usage = OSContainer::memory_usage_in_bytes();
+    if (limit > 0 && usage >= 0) {
+      return limit > usage ? (size_t)(limit - usage) : 0;
+    }
+  }
+#endif
+  return SIZE_MAX;
+}
+
+void ZDirector::update_memory_pressure_max_capacity(const ZDirectorStats& stats) {
+  if (ZMemoryPressureThreshold == 0.0) {
+    // Disabled
+    return;
+  }
+
+  if (_memory_pressure_ticks++ % decision_hz != 0) {
+    // Sample the container memory once per second
+    return;
+  }
+
+  const double pressure = container_memory_pressure();
+  const size_t headroom = container_memory_headroom();
+  if (pressure < 0.0 && headroom == SIZE_MAX) {
+    // Not available
+    return;
+  }
+
+  if (!_under_memory_pressure && pressure >= ZMemoryPressureThreshold) {
+    log_info(gc, director)("Memory pressure %.2f%% reached threshold %.2f%%", pressure, ZMemoryPressureThreshold);
+    _under_memory_pressure = true;
+  } else if (_under_memory_pressure && pressure < ZMemoryPressureThreshold / 2.0) {
+    log_info(gc, director)("Memory pressure %.2f%% dropped below %.2f%%", pressure, ZMemoryPressureThreshold / 2.0);
+    _under_memory_pressure = false;
+  }
+
+  ZHeap* const heap = ZHeap::heap();
+  size_t max_capacity = heap->max_capacity();
+
+  if (headroom != SIZE_MAX) {
+    // Don't let the heap grow beyond what the container can still provide
+    max_capacity = MIN2(max_capacity, heap->capacity() + headroom);
+  }
+
+  if (_under_memory_pressure) {
+    // Lower the soft max capacity half way towards the current usage, but
+    // leave 25% above what survived the last major collection.
+    const size_t soft_max_capacity = stats._heap._soft_max_heap_size;
+    const size_t used = stats._heap._used;
+    const size_t lowered = used + ((soft_max_capacity - MIN2(soft_max_capacity, used)) / 2);
+    const size_t live = stats._old_stats._stat_heap._used_at_relocate_end;
+    max_capacity = MIN2(max_capacity, MAX2(lowered, live + (live / 4)));
+  }
+
+  max_capacity = clamp(align_up(max_capacity, ZGranuleSize), heap->min_capacity(), heap->max_capacity());
+
+  if (headroom != SIZE_MAX) {
+    log_debug(gc, director)("Rule: Memory Pressure, Pressure: %.2f%%, Headroom: " SIZE_FORMAT "MB, MaxCapacity: " SIZE_FORMAT "MB",
+                            pressure, headroom / M, max_capacity / M);
+  } else {
+    log_debug(gc, director)("Rule: Memory Pressure, Pressure: %.2f%%, MaxCapacity: " SIZE_FORMAT "MB",
+                            pressure, max_capacity / M);
+  }
+
+  if (max_capacity != heap->memory_pressure_max_capacity()) {
+    heap->set_memory_pressure_max_capacity(max_capacity);
+  }
+}
+
 void ZDirector::run_thread() {
   // Main loop
   while (wait_for_tick()) {
     ZDirectorStats stats = sample_stats();
+    update_memory_pressure_max_capacity(stats);
     if (!start_gc(stats)) {
       adjust_gc(stats);
     }
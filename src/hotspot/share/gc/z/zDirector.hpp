@@ -27,6 +27,8 @@
 #include "gc/z/zLock.hpp"
 #include "gc/z/zThread.hpp"
 
+struct ZDirectorStats;
+
 class ZDirector : public ZThread {
 private:
   static const uint64_t decision_hz = 100;
@@ -34,8 +36,11 @@ class ZDirector : public ZThread {
 
   ZConditionLock _monitor;
   bool           _stopped;
+  uint64_t       _memory_pressure_ticks;
+  bool           _under_memory_pressure;
 
   bool wait_for_tick();
+  void update_memory_pressure_max_capacity(const ZDirectorStats& stats);
 
 protected:
   virtual void run_thread();
@@ -96,7 +96,7 @@ bool ZForwarding::retain_page(ZRelocateQueue* queue) {
 
     if (ref_count < 0) {
       // Claimed
-      queue->add_and_wait(this);
+      queue->add_and_wait(this, 0 /* relocated */, false /* budget_exhausted */);
 
       // Released
       return false;
@@ -65,6 +65,13 @@
 #include "runtime/vmThread.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/events.hpp"
+#include "utilities/ticks.hpp"
+
+static const ZStatCounter ZCounterEarlyPromoted("Memory", "Early Promoted", ZStatUnitBytesPerSecond);
+static const ZStatCounter ZCounterEarlyPromotionMispredicted("Memory", "Early Promotion Mispredicted", ZStatUnitOpsPerSecond);
+
+// Number of young collections between samples of the survival rate of the early promotion age
+static const uint ZEarlyPromotionRevalidateInterval = 8;
 
 static const ZStatPhaseGeneration ZPhaseGenerationYoung[] {
   ZStatPhaseGeneration("Young Generation", ZGenerationId::young),
@@ -130,6 +137,8 @@ ZGeneration::ZGeneration(ZGenerationId id, ZPageTable* page_table, ZPageAllocato
     _stat_workers(),
     _stat_mark(),
     _stat_relocation(),
+    _relocation_set_cost(0),
+    _relocation_cost(),
     _gc_timer(nullptr) {}
 
 bool ZGeneration::is_initialized() const {
@@ -187,9 +196,34 @@ static double fragmentation_limit(ZGenerationId generation) {
   }
 }
 
+size_t ZGeneration::relocation_cost_budget() const {
+  if (!ZRelocationCostModel || _relocation_cost.num() == 0) {
+    // No budget
+    return SIZE_MAX;
+  }
+
+  // Relocation should complete before the heap would run out of memory at
+  // the current allocation rate, leaving half of that time as headroom.
+  const ZStatMutatorAllocRateStats alloc_rate_stats = ZStatMutatorAllocRate::stats();
+  const double alloc_rate = MAX2(alloc_rate_stats._predict, alloc_rate_stats._avg) + alloc_rate_stats._sd + 1.0;
+  const size_t soft_max_capacity = _page_allocator->soft_max_capacity();
+  const size_t used = _page_allocator->used();
+  const double free = soft_max_capacity > used ? (double)(soft_max_capacity - used) : 0.0;
+  const double time_until_oom = free / alloc_rate;
+  const double time_budget = MAX2(time_until_oom * 0.5, 0.001 /* 1ms */);
+
+  const double cost_per_second = (double)_workers.active_workers() / MAX2(_relocation_cost.davg(), 1e-12);
+  const double budget = time_budget * cost_per_second;
+
+  log_debug(gc, reloc)("Relocation Cost Budget: %.3fs, " SIZE_FORMAT "M",
+                       time_budget, (size_t)MIN2(budget, (double)SIZE_MAX) / M);
+
+  return budget >= (double)SIZE_MAX ? SIZE_MAX : (size_t)budget;
+}
+
 void ZGeneration::select_relocation_set(ZGenerationId generation, bool promote_all) {
   // Register relocatable pages with selector
-  ZRelocationSetSelector selector(fragmentation_limit(generation));
+  ZRelocationSetSelector selector(fragmentation_limit(generation), relocation_cost_budget());
   {
     ZGenerationPagesIterator pt_iter(_page_table, _id, _page_allocator);
     for (ZPage* page; pt_iter.next(&page);) {
@@ -259,11 +293,28 @@ void ZGeneration::select_relocation_set(ZGenerationId generation, bool promote_a
     _forwarding_table.insert(forwarding);
   }
 
+  // Remember predicted cost, for updating the cost model after relocation
+  _relocation_set_cost = selector.relocation_cost();
+
   // Update statistics
   stat_relocation()->at_select_relocation_set(selector.stats());
   stat_heap()->at_select_relocation_set(selector.stats());
 }
 
+void ZGeneration::relocate_relocation_set() {
+  const Ticks start = Ticks::now();
+
+  // Relocate relocation set
+  _relocate.relocate(&_relocation_set);
+
+  // Update relocation cost model. Small relocation sets are
+  // dominated by fixed overheads and are not sampled.
+  if (_relocation_set_cost >= ZPageSizeMedium) {
+    const double worker_seconds = (Ticks::now() - start).seconds() * _workers.active_workers();
+    _relocation_cost.add(worker_seconds / (double)_relocation_set_cost);
+  }
+}
+
 ZRelocationSetParallelIterator ZGeneration::relocation_set_parallel_iterator() {
   return ZRelocationSetParallelIterator(&_relocation_set);
 }
@@ -494,6 +545,10 @@ ZGenerationYoung::ZGenerationYoung(ZPageTable* page_table,
   : ZGeneration(ZGenerationId::young, page_table, page_allocator),
     _active_type(ZYoungType::none),
     _tenuring_threshold(0),
+    _live_per_age(),
+    _survival_rate(),
+    _early_promotion_age(ZPageAgeMax),
+    _early_promotion_cycles(0),
     _remembered(page_table, old_forwarding_table, page_allocator),
     _jfr_tracer() {
   ZGeneration::_young = this;
@@ -695,6 +750,11 @@ void ZGenerationYoung::concurrent_reset_relocation_set() {
 }
 
 void ZGenerationYoung::select_tenuring_threshold(ZRelocationSetSelectorStats stats, bool promote_all) {
+  if (ZEarlyPromotionSurvivalRate > 0.0) {
+    // Must be done before the tenuring threshold of the previous cycle is replaced
+    update_survival_rates(stats);
+  }
+
   const char* reason = "";
   if (promote_all) {
     _tenuring_threshold = 0;
@@ -705,10 +765,84 @@ void ZGenerationYoung::select_tenuring_threshold(ZRelocationSetSelectorStats sta
   } else {
     _tenuring_threshold = compute_tenuring_threshold(stats);
     reason = "Computed";
+
+    if (ZEarlyPromotionSurvivalRate > 0.0) {
+      const uint early_promotion_threshold = select_early_promotion_threshold(stats, _tenuring_threshold);
+      if (early_promotion_threshold < _tenuring_threshold) {
+        _tenuring_threshold = early_promotion_threshold;
+        reason = "Early Promotion";
+      }
+    }
   }
   log_info(gc, reloc)("Using tenuring threshold: %d (%s)", _tenuring_threshold, reason);
 }
 
+static size_t young_live(const ZRelocationSetSelectorStats& stats, uint age) {
+  const ZPageAge page_age = static_cast<ZPageAge>(age);
+  return stats.small(page_age).live() + stats.medium(page_age).live() + stats.large(page_age).live();
+}
+
+void ZGenerationYoung::update_survival_rates(const ZRelocationSetSelectorStats& stats) {
+  // Live objects of age i are relocated or flipped to age i + 1 by a young
+  // collection, unless age i was at or above the tenuring threshold. The
+  // survival rate of age i is therefore the live bytes of age i + 1 now,
+  // compared to the live bytes of age i in the previous young collection.
+  for (uint i = 0; i + 1 < ZPageAgeMax; ++i) {
+    if (i >= _tenuring_threshold || _live_per_age[i] == 0) {
+      // No sample, keep the last known survival rate
+      continue;
+    }
+
+    const double survival_rate = MIN2(double(young_live(stats, i + 1)) / double(_live_per_age[i]), 1.0);
+
+    if (i == _early_promotion_age && survival_rate * 100.0 < ZEarlyPromotionSurvivalRate) {
+      // Objects of this age were promoted early, but no longer survive as predicted
+      ZStatInc(ZCounterEarlyPromotionMispredicted);
+      log_debug(gc, reloc)("Early Promotion Mispredicted: Age %u, Survival Rate: %.1f%%", i, survival_rate * 100.0);
+    }
+
+    _survival_rate[i] = survival_rate;
+  }
+
+  for (uint i = 0; i < ZPageAgeMax; ++i) {
+    _live_per_age[i] = young_live(stats, i);
+  }
+}
+
+uint ZGenerationYoung::select_early_promotion_threshold(const ZRelocationSetSelectorStats& stats, uint tenuring_threshold) {
+  if (_early_promotion_age < ZPageAgeMax && ++_early_promotion_cycles % ZEarlyPromotionRevalidateInterval == 0) {
+    // Don't promote early for one cycle, so that the survival rate of the
+    // early promotion age is sampled again and a misprediction is detected.
+    log_debug(gc, reloc)("Early Promotion: Revalidate Age %u", _early_promotion_age);
+    return tenuring_threshold;
+  }
+
+  // Eden objects are never promoted early, as they are the ones expected to die young
+  _early_promotion_age = ZPageAgeMax;
+  for (uint i = 1; i + 1 < ZPageAgeMax; ++i) {
+    if (_survival_rate[i] * 100.0 >= ZEarlyPromotionSurvivalRate) {
+      _early_promotion_age = i;
+      break;
+    }
+  }
+
+  if (_early_promotion_age >= tenuring_threshold) {
+    // Not earlier than the computed tenuring threshold
+    return tenuring_threshold;
+  }
+
+  size_t early_promoted = 0;
+  for (uint i = _early_promotion_age; i < tenuring_threshold; ++i) {
+    early_promoted += young_live(stats, i);
+  }
+  ZStatInc(ZCounterEarlyPromoted, early_promoted);
+
+  log_debug(gc, reloc)("Early Promotion: Age %u, Survival Rate: %.1f%%, Promoted: " SIZE_FORMAT "M",
+                       _early_promotion_age, _survival_rate[_early_promotion_age] * 100.0, early_promoted / M);
+
+  return _early_promotion_age;
+}
+
 uint ZGenerationYoung::compute_tenuring_threshold(ZRelocationSetSelectorStats stats) {
   size_t young_live_total = 0;
   size_t young_live_last = 0;
@@ -929,7 +1063,7 @@ void ZGenerationYoung::relocate_start() {
 
 void ZGenerationYoung::relocate() {
   // Relocate relocation set
-  _relocate.relocate(&_relocation_set);
+  relocate_relocation_set();
 
   // Update statistics
   stat_heap()->at_relocate_end(_page_allocator->stats(this), should_record_stats());
@@ -1391,7 +1525,7 @@ void ZGenerationOld::relocate_start() {
 
 void ZGenerationOld::relocate() {
   // Relocate relocation set
-  _relocate.relocate(&_relocation_set);
+  relocate_relocation_set();
 
   // Update statistics
   stat_heap()->at_relocate_end(_page_allocator->stats(this), should_record_stats());
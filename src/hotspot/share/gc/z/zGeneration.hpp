@@ -27,6 +27,7 @@
 #include "gc/z/zForwardingTable.hpp"
 #include "gc/z/zGenerationId.hpp"
 #include "gc/z/zMark.hpp"
+#include "gc/z/zPageAge.hpp"
 #include "gc/z/zReferenceProcessor.hpp"
 #include "gc/z/zRelocate.hpp"
 #include "gc/z/zRelocationSet.hpp"
@@ -37,6 +38,7 @@
 #include "gc/z/zWeakRootsProcessor.hpp"
 #include "gc/z/zWorkers.hpp"
 #include "memory/allocation.hpp"
+#include "utilities/numberSeq.hpp"
 
 class ThreadClosure;
 class ZForwardingTable;
@@ -83,6 +85,10 @@ class ZGeneration {
   ZStatMark             _stat_mark;
   ZStatRelocation       _stat_relocation;
 
+  // Relocation cost model, in worker seconds per unit of relocation cost
+  size_t                _relocation_set_cost;
+  TruncatedSeq          _relocation_cost;
+
   ConcurrentGCTimer*    _gc_timer;
 
   void free_empty_pages(ZRelocationSetSelector* selector, int bulk);
@@ -91,8 +97,10 @@ class ZGeneration {
 
   void mark_free();
 
+  size_t relocation_cost_budget() const;
   void select_relocation_set(ZGenerationId generation, bool promote_all);
   void reset_relocation_set();
+  void relocate_relocation_set();
 
   ZGeneration(ZGenerationId id, ZPageTable* page_table, ZPageAllocator* page_allocator);
 
@@ -198,6 +206,10 @@ class ZGenerationYoung : public ZGeneration {
 private:
   ZYoungType   _active_type;
   uint         _tenuring_threshold;
+  size_t       _live_per_age[ZPageAgeMax];
+  double       _survival_rate[ZPageAgeMax];
+  uint         _early_promotion_age;
+  uint         _early_promotion_cycles;
   ZRemembered  _remembered;
   ZYoungTracer _jfr_tracer;
 
@@ -243,9 +255,12 @@ class ZGenerationYoung : public ZGeneration {
   uint tenuring_threshold();
   void select_tenuring_threshold(ZRelocationSetSelectorStats stats, bool promote_all);
   uint compute_tenuring_threshold(ZRelocationSetSelectorStats stats);
+  void update_survival_rates(const ZRelocationSetSelectorStats& stats);
+  uint select_early_promotion_threshold(const ZRelocationSetSelectorStats& stats, uint tenuring_threshold);
 
   // Add remembered set entries
   void remember(volatile zpointer* p);
+  void remember(volatile zpointer** fields, size_t count);
   void remember_fields(zaddress addr);
 
   // Scan a remembered set entry
@@ -159,6 +159,10 @@ inline void ZGenerationYoung::remember(volatile zpointer* p) {
   _remembered.remember(p);
 }
 
+inline void ZGenerationYoung::remember(volatile zpointer** fields, size_t count) {
+  _remembered.remember(fields, count);
+}
+
 inline void ZGenerationYoung::scan_remembered_field(volatile zpointer* p) {
   _remembered.scan_field(p);
 }
@@ -55,6 +55,8 @@ class ZGranuleMap {
   T get_acquire(zoffset offset) const;
   void release_put(zoffset offset, T value);
   void release_put(zoffset offset, size_t size, T value);
+
+  T cmpxchg(zoffset offset, T compare_value, T new_value);
 };
 
 template <typename T, bool Parallel>
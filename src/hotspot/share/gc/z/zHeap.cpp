@@ -110,6 +110,14 @@ size_t ZHeap::soft_max_capacity() const {
   return _page_allocator.soft_max_capacity();
 }
 
+size_t ZHeap::memory_pressure_max_capacity() const {
+  return _page_allocator.memory_pressure_max_capacity();
+}
+
+void ZHeap::set_memory_pressure_max_capacity(size_t capacity) {
+  _page_allocator.set_memory_pressure_max_capacity(capacity);
+}
+
 size_t ZHeap::capacity() const {
   return _page_allocator.capacity();
 }
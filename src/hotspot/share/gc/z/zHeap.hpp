@@ -71,6 +71,8 @@ class ZHeap {
   size_t min_capacity() const;
   size_t max_capacity() const;
   size_t soft_max_capacity() const;
+  size_t memory_pressure_max_capacity() const;
+  void set_memory_pressure_max_capacity(size_t capacity);
   size_t capacity() const;
   size_t used() const;
   size_t used_generation(ZGenerationId id) const;
@@ -28,7 +28,6 @@
 #include "gc/shared/taskTerminator.hpp"
 #include "gc/shared/taskqueue.hpp"
 #include "gc/z/zGranuleMap.hpp"
-#include "gc/z/zLock.hpp"
 #include "gc/z/zRootsIterator.hpp"
 #include "gc/z/zStat.hpp"
 
@@ -52,7 +51,6 @@ class ZHeapIterator : public ParallelObjectIteratorImpl {
   const bool                    _visit_weaks;
   const bool                    _for_verify;
   ZHeapIteratorBitMaps          _bitmaps;
-  ZLock                         _bitmaps_lock;
   ZHeapIteratorQueues           _queues;
   ZHeapIteratorArrayChunkQueues _array_chunk_queues;
   ZRootsIteratorStrongColored   _roots_colored;
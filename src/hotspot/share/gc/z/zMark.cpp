@@ -45,6 +45,7 @@
 #include "gc/z/zMarkStack.inline.hpp"
 #include "gc/z/zMarkTerminate.inline.hpp"
 #include "gc/z/zNMethod.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPage.hpp"
 #include "gc/z/zPageTable.inline.hpp"
 #include "gc/z/zRootsIterator.hpp"
@@ -130,10 +131,12 @@ void ZMark::start() {
 
   // Print worker/stripe distribution
   LogTarget(Debug, gc, marking) log;
-  if (log.is_enabled()) {
+  if (log.is_enabled() && _stripes.is_numa_aware()) {
+    log.print("Mark Worker/Stripe Distribution: Follows NUMA node of worker");
+  } else if (log.is_enabled()) {
     log.print("Mark Worker/Stripe Distribution");
     for (uint worker_id = 0; worker_id < _nworkers; worker_id++) {
-      const ZMarkStripe* const stripe = _stripes.stripe_for_worker(_nworkers, worker_id);
+      const ZMarkStripe* const stripe = _stripes.stripe_for_worker(_nworkers, worker_id, 0 /* numa_id */);
       const size_t stripe_id = _stripes.stripe_id(stripe);
       log.print("  Worker %u(%u) -> Stripe " SIZE_FORMAT "(" SIZE_FORMAT ")",
                 worker_id, _nworkers, stripe_id, nstripes);
@@ -190,7 +193,9 @@ static zpointer* decode_partial_array_offset(uintptr_t offset) {
 void ZMark::push_partial_array(zpointer* addr, size_t length, bool finalizable) {
   assert(is_aligned(addr, ZMarkPartialArrayMinSize), "Address misaligned");
   ZMarkThreadLocalStacks* const stacks = ZThreadLocalData::mark_stacks(Thread::current(), _generation->id());
-  ZMarkStripe* const stripe = _stripes.stripe_for_addr((uintptr_t)addr);
+  // Partial arrays are pushed by the thread following the array, which
+  // most likely runs on the node the array is located on
+  ZMarkStripe* const stripe = _stripes.stripe_for_addr((uintptr_t)addr, ZNUMA::id());
   const uintptr_t offset = encode_partial_array_offset(addr);
   const ZMarkStackEntry entry(offset, length, finalizable);
 
@@ -479,7 +484,7 @@ bool ZMark::rebalance_work(ZMarkContext* context) {
     context->set_nstripes(new_nstripes);
   }
 
-  ZMarkStripe* stripe = _stripes.stripe_for_worker(_nworkers, WorkerThread::worker_id());
+  ZMarkStripe* stripe = _stripes.stripe_for_worker(_nworkers, WorkerThread::worker_id(), ZNUMA::id());
   if (context->stripe() != stripe) {
     // Need to switch stripe
     context->set_stripe(stripe);
@@ -499,7 +504,7 @@ bool ZMark::drain(ZMarkContext* context) {
   ZMarkStackEntry entry;
   size_t processed = 0;
 
-  context->set_stripe(_stripes.stripe_for_worker(_nworkers, WorkerThread::worker_id()));
+  context->set_stripe(_stripes.stripe_for_worker(_nworkers, WorkerThread::worker_id(), ZNUMA::id()));
   context->set_nstripes(_stripes.nstripes());
 
   // Drain stripe stacks
@@ -518,15 +523,22 @@ bool ZMark::try_steal_local(ZMarkContext* context) {
   ZMarkStripe* const stripe = context->stripe();
   ZMarkThreadLocalStacks* const stacks = context->stacks();
 
-  // Try to steal a local stack from another stripe
-  for (ZMarkStripe* victim_stripe = _stripes.stripe_next(stripe);
-       victim_stripe != stripe;
-       victim_stripe = _stripes.stripe_next(victim_stripe)) {
-    ZMarkStack* const stack = stacks->steal(&_stripes, victim_stripe);
-    if (stack != nullptr) {
-      // Success, install the stolen stack
-      stacks->install(&_stripes, stripe, stack);
-      return true;
+  // Try to steal a local stack from another stripe, preferring
+  // stripes of the same NUMA node
+  for (int pass = 0; pass < (_stripes.is_numa_aware() ? 2 : 1); pass++) {
+    for (ZMarkStripe* victim_stripe = _stripes.stripe_next(stripe);
+         victim_stripe != stripe;
+         victim_stripe = _stripes.stripe_next(victim_stripe)) {
+      if (_stripes.is_numa_aware() && _stripes.is_same_node(stripe, victim_stripe) != (pass == 0)) {
+        continue;
+      }
+
+      ZMarkStack* const stack = stacks->steal(&_stripes, victim_stripe);
+      if (stack != nullptr) {
+        // Success, install the stolen stack
+        stacks->install(&_stripes, stripe, stack);
+        return true;
+      }
     }
   }
 
@@ -538,15 +550,22 @@ bool ZMark::try_steal_global(ZMarkContext* context) {
   ZMarkStripe* const stripe = context->stripe();
   ZMarkThreadLocalStacks* const stacks = context->stacks();
 
-  // Try to steal a stack from another stripe
-  for (ZMarkStripe* victim_stripe = _stripes.stripe_next(stripe);
-       victim_stripe != stripe;
-       victim_stripe = _stripes.stripe_next(victim_stripe)) {
-    ZMarkStack* const stack = victim_stripe->steal_stack();
-    if (stack != nullptr) {
-      // Success, install the stolen stack
-      stacks->install(&_stripes, stripe, stack);
-      return true;
+  // Try to steal a stack from another stripe, preferring
+  // stripes of the same NUMA node
+  for (int pass = 0; pass < (_stripes.is_numa_aware() ? 2 : 1); pass++) {
+    for (ZMarkStripe* victim_stripe = _stripes.stripe_next(stripe);
+         victim_stripe != stripe;
+         victim_stripe = _stripes.stripe_next(victim_stripe)) {
+      if (_stripes.is_numa_aware() && _stripes.is_same_node(stripe, victim_stripe) != (pass == 0)) {
+        continue;
+      }
+
+      ZMarkStack* const stack = victim_stripe->steal_stack();
+      if (stack != nullptr) {
+        // Success, install the stolen stack
+        stacks->install(&_stripes, stripe, stack);
+        return true;
+      }
     }
   }
 
@@ -656,7 +675,7 @@ void ZMark::leave() {
 // Returning true means marking finished successfully after marking as far as it could.
 // Returning false means that marking finished unsuccessfully due to abort or resizing.
 bool ZMark::follow_work(bool partial) {
-  ZMarkStripe* const stripe = _stripes.stripe_for_worker(_nworkers, WorkerThread::worker_id());
+  ZMarkStripe* const stripe = _stripes.stripe_for_worker(_nworkers, WorkerThread::worker_id(), ZNUMA::id());
   ZMarkThreadLocalStacks* const stacks = ZThreadLocalData::mark_stacks(Thread::current(), _generation->id());
   ZMarkContext context(ZMarkStripesMax, stripe, stacks);
 
@@ -760,6 +779,33 @@ class ZMarkNMethodClosure : public NMethodClosure {
   }
 };
 
+// Marks young objects reachable from the oops of an nmethod, and records
+// whether any of the healed oops still refer to an object in a young page.
+class ZMarkYoungNMethodOopClosure : public ZUncoloredRootClosure {
+private:
+  const uintptr_t _color;
+  bool            _found_young;
+
+public:
+  ZMarkYoungNMethodOopClosure(uintptr_t color)
+    : _color(color),
+      _found_young(false) {}
+
+  virtual void do_root(zaddress_unsafe* p) {
+    ZUncoloredRoot::mark_young(p, _color);
+
+    // The root has been healed and is now load good
+    const zaddress addr = safe(Atomic::load(p));
+    if (!is_null(addr) && ZHeap::heap()->is_young(addr)) {
+      _found_young = true;
+    }
+  }
+
+  bool found_young() const {
+    return _found_young;
+  }
+};
+
 class ZMarkYoungNMethodClosure : public NMethodClosure {
 private:
   ZBarrierSetNMethod* const _bs_nm;
@@ -777,9 +823,18 @@ class ZMarkYoungNMethodClosure : public NMethodClosure {
     if (_bs_nm->is_armed(nm)) {
       const uintptr_t prev_color = ZNMethod::color(nm);
 
-      // Heal oops
-      ZUncoloredRootMarkYoungOopClosure cl(prev_color);
-      ZNMethod::nmethod_oops_do_inner(nm, &cl);
+      // Heal oops. An nmethod that only refers to old objects has nothing
+      // to offer young marking, and as long as no old relocation happened
+      // since it was last healed its oops are already load good. Objects
+      // never move from old to young, and patching in new oops re-registers
+      // the nmethod, so such nmethods can skip the oop walk altogether.
+      const bool skip_oops = !ZNMethod::has_young_oops(nm) &&
+                             ZPointer::is_old_load_good(ZAddress::color(zaddress::null, prev_color));
+      if (!skip_oops) {
+        ZMarkYoungNMethodOopClosure cl(prev_color);
+        ZNMethod::nmethod_oops_do_inner(nm, &cl);
+        ZNMethod::set_has_young_oops(nm, cl.found_young());
+      }
 
       // Disarm only the young marking, not any potential old marking cycle
 
@@ -799,10 +854,10 @@ class ZMarkYoungNMethodClosure : public NMethodClosure {
       _bs_nm->set_guard_value(nm, (int)untype(new_disarm_value_ptr));
 
       if (complete_disarm) {
-        log_trace(gc, nmethod)("nmethod: " PTR_FORMAT " visited by young (complete) [" PTR_FORMAT " -> " PTR_FORMAT "]", p2i(nm), prev_color, untype(new_disarm_value_ptr));
+        log_trace(gc, nmethod)("nmethod: " PTR_FORMAT " visited by young (complete%s) [" PTR_FORMAT " -> " PTR_FORMAT "]", p2i(nm), skip_oops ? ", old only" : "", prev_color, untype(new_disarm_value_ptr));
         assert(!_bs_nm->is_armed(nm), "Must not be considered armed anymore");
       } else {
-        log_trace(gc, nmethod)("nmethod: " PTR_FORMAT " visited by young (incomplete) [" PTR_FORMAT " -> " PTR_FORMAT "]", p2i(nm), prev_color, untype(new_disarm_value_ptr));
+        log_trace(gc, nmethod)("nmethod: " PTR_FORMAT " visited by young (incomplete%s) [" PTR_FORMAT " -> " PTR_FORMAT "]", p2i(nm), skip_oops ? ", old only" : "", prev_color, untype(new_disarm_value_ptr));
         assert(_bs_nm->is_armed(nm), "Must be considered armed");
       }
     }
@@ -1012,11 +1067,13 @@ bool ZMark::end() {
 }
 
 void ZMark::free() {
+  const size_t spilled = _allocator.spilled();
+
   // Free any unused mark stack space
   _allocator.free();
 
   // Update statistics
-  _generation->stat_mark()->at_mark_free(_allocator.size());
+  _generation->stat_mark()->at_mark_free(_allocator.size(), spilled);
 }
 
 void ZMark::flush_and_free() {
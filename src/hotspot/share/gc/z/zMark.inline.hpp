@@ -78,7 +78,8 @@ inline void ZMark::mark_object(zaddress addr) {
 
   // Push
   ZMarkThreadLocalStacks* const stacks = ZThreadLocalData::mark_stacks(Thread::current(), _generation->id());
-  ZMarkStripe* const stripe = _stripes.stripe_for_addr(untype(addr));
+  const uint32_t numa_id = _stripes.is_numa_aware() ? page->numa_id() : 0;
+  ZMarkStripe* const stripe = _stripes.stripe_for_addr(untype(addr), numa_id);
   ZMarkStackEntry entry(untype(ZAddress::offset(addr)), !mark_before_push, inc_live, follow, finalizable);
 
   assert(ZHeap::heap()->is_young(addr) == _generation->is_young(), "Phase/object mismatch");
@@ -25,6 +25,7 @@
 #include "gc/z/zMarkStack.inline.hpp"
 #include "gc/z/zMarkStackAllocator.hpp"
 #include "gc/z/zMarkTerminate.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "logging/log.hpp"
 #include "runtime/atomic.hpp"
 #include "utilities/debug.hpp"
@@ -34,8 +35,17 @@ ZMarkStripe::ZMarkStripe(uintptr_t base)
   : _published(base),
     _overflowed(base) {}
 
+static size_t calculate_nnodes() {
+  // The number of node groups must be a power of two, so that it evenly
+  // divides the number of stripes. Nodes with an id above the number of
+  // node groups share group with a lower node.
+  const size_t nnodes = round_down_power_of_2(ZNUMA::count());
+  return MIN2(nnodes, ZMarkStripesMax);
+}
+
 ZMarkStripeSet::ZMarkStripeSet(uintptr_t base)
   : _nstripes_mask(0),
+    _nnodes(calculate_nnodes()),
     _stripes() {
 
   // Re-construct array elements with the correct base
@@ -71,9 +81,38 @@ bool ZMarkStripeSet::is_empty() const {
   return true;
 }
 
-ZMarkStripe* ZMarkStripeSet::stripe_for_worker(uint nworkers, uint worker_id) {
+size_t ZMarkStripeSet::nnodes(size_t nstripes) const {
+  // Can't have more node groups than stripes
+  return MIN2(_nnodes, nstripes);
+}
+
+bool ZMarkStripeSet::is_same_node(const ZMarkStripe* stripe0, const ZMarkStripe* stripe1) const {
+  const size_t used_nstripes = nstripes();
+  const size_t index0 = stripe_id(stripe0);
+  const size_t index1 = stripe_id(stripe1);
+
+  if (index0 >= used_nstripes || index1 >= used_nstripes) {
+    // Stripes not in use are not part of any node group
+    return false;
+  }
+
+  const size_t nstripes_per_node = used_nstripes / nnodes(used_nstripes);
+  return (index0 / nstripes_per_node) == (index1 / nstripes_per_node);
+}
+
+ZMarkStripe* ZMarkStripeSet::stripe_for_worker(uint nworkers, uint worker_id, uint32_t numa_id) {
   const size_t mask = Atomic::load(&_nstripes_mask);
   const size_t nstripes = mask + 1;
+  const size_t used_nnodes = nnodes(nstripes);
+
+  if (used_nnodes > 1) {
+    // Use a stripe in the group of the node the worker is running on
+    const size_t nstripes_per_node = nstripes / used_nnodes;
+    const size_t node = numa_id & (used_nnodes - 1);
+    const size_t index = node * nstripes_per_node + (worker_id & (nstripes_per_node - 1));
+    assert(index < nstripes, "Invalid index");
+    return &_stripes[index];
+  }
 
   const size_t spillover_limit = (nworkers / nstripes) * nstripes;
   size_t index;
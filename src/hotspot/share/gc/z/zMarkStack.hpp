@@ -93,11 +93,17 @@ class ZMarkStripe {
   ZMarkStack* steal_stack();
 };
 
+// When NUMA is enabled, the stripes are split into one group per NUMA node.
+// Objects are pushed to a stripe in the group of the node their page is
+// located on, and workers prefer the stripes of the node they run on.
 class ZMarkStripeSet {
 private:
   size_t      _nstripes_mask;
+  size_t      _nnodes;
   ZMarkStripe _stripes[ZMarkStripesMax];
 
+  size_t nnodes(size_t nstripes) const;
+
 public:
   explicit ZMarkStripeSet(uintptr_t base);
 
@@ -105,12 +111,15 @@ class ZMarkStripeSet {
   size_t nstripes() const;
 
   bool is_empty() const;
+  bool is_numa_aware() const;
 
   size_t stripe_id(const ZMarkStripe* stripe) const;
   ZMarkStripe* stripe_at(size_t index);
   ZMarkStripe* stripe_next(ZMarkStripe* stripe);
-  ZMarkStripe* stripe_for_worker(uint nworkers, uint worker_id);
-  ZMarkStripe* stripe_for_addr(uintptr_t addr);
+  ZMarkStripe* stripe_for_worker(uint nworkers, uint worker_id, uint32_t numa_id);
+  ZMarkStripe* stripe_for_addr(uintptr_t addr, uint32_t numa_id);
+
+  bool is_same_node(const ZMarkStripe* stripe0, const ZMarkStripe* stripe1) const;
 };
 
 class ZMarkStackAllocator;
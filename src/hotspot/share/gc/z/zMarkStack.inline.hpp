@@ -194,6 +194,10 @@ inline ZMarkStack* ZMarkStripe::steal_stack() {
   return _published.pop();
 }
 
+inline bool ZMarkStripeSet::is_numa_aware() const {
+  return _nnodes > 1;
+}
+
 inline size_t ZMarkStripeSet::stripe_id(const ZMarkStripe* stripe) const {
   const size_t index = ((uintptr_t)stripe - (uintptr_t)_stripes) / sizeof(ZMarkStripe);
   assert(index < ZMarkStripesMax, "Invalid index");
@@ -211,8 +215,12 @@ inline ZMarkStripe* ZMarkStripeSet::stripe_next(ZMarkStripe* stripe) {
   return &_stripes[index];
 }
 
-inline ZMarkStripe* ZMarkStripeSet::stripe_for_addr(uintptr_t addr) {
-  const size_t index = (addr >> ZMarkStripeShift) & Atomic::load(&_nstripes_mask);
+inline ZMarkStripe* ZMarkStripeSet::stripe_for_addr(uintptr_t addr, uint32_t numa_id) {
+  const size_t nstripes = Atomic::load(&_nstripes_mask) + 1;
+  const size_t nnodes = MIN2(_nnodes, nstripes);
+  const size_t nstripes_per_node = nstripes / nnodes;
+  const size_t node = numa_id & (nnodes - 1);
+  const size_t index = node * nstripes_per_node + ((addr >> ZMarkStripeShift) & (nstripes_per_node - 1));
   assert(index < ZMarkStripesMax, "Invalid index");
   return &_stripes[index];
 }
@@ -36,11 +36,14 @@ ZMarkStackSpace::ZMarkStackSpace()
   : _expand_lock(),
     _start(0),
     _top(0),
-    _end(0) {
+    _end(0),
+    _reserved(0),
+    _spilled(0) {
   assert(ZMarkStackSpaceLimit >= ZMarkStackSpaceExpandSize, "ZMarkStackSpaceLimit too small");
 
-  // Reserve address space
-  const size_t size = ZMarkStackSpaceLimit;
+  // Reserve address space. The spill space is reserved directly after the
+  // regular space, but is only committed when the regular space runs out.
+  const size_t size = ZMarkStackSpaceLimit + align_up(ZMarkStackSpillLimit, ZMarkStackSpaceExpandSize);
   const uintptr_t addr = (uintptr_t)os::reserve_memory(size, !ExecMem, mtGC);
   if (addr == 0) {
     log_error_pd(gc, marking)("Failed to reserve address space for mark stacks");
@@ -49,6 +52,7 @@ ZMarkStackSpace::ZMarkStackSpace()
 
   // Successfully initialized
   _start = _top = _end = addr;
+  _reserved = size;
 
   // Prime space
   _end += expand_space();
@@ -66,6 +70,10 @@ size_t ZMarkStackSpace::size() const {
   return _end - _start;
 }
 
+size_t ZMarkStackSpace::spilled() const {
+  return Atomic::load(&_spilled);
+}
+
 size_t ZMarkStackSpace::used() const {
   return _top - _start;
 }
@@ -75,12 +83,23 @@ size_t ZMarkStackSpace::expand_space() {
   const size_t old_size = size();
   const size_t new_size = old_size + expand_size;
 
-  if (new_size > ZMarkStackSpaceLimit) {
+  if (new_size > _reserved) {
     // Expansion limit reached. This is a fatal error since we
     // currently can't recover from running out of mark stack space.
     fatal("Mark stack space exhausted. Use -XX:ZMarkStackSpaceLimit=<size> to increase the "
-          "maximum number of bytes allocated for mark stacks. Current limit is " SIZE_FORMAT "M.",
-          ZMarkStackSpaceLimit / M);
+          "maximum number of bytes allocated for mark stacks. Current limit is " SIZE_FORMAT "M, "
+          "of which " SIZE_FORMAT "M is spill space.",
+          _reserved / M, (_reserved - ZMarkStackSpaceLimit) / M);
+  }
+
+  if (new_size > ZMarkStackSpaceLimit) {
+    // Spill into the space reserved beyond the regular limit
+    if (old_size <= ZMarkStackSpaceLimit) {
+      log_warning(gc, marking)("Mark stack space exhausted, spilling beyond ZMarkStackSpaceLimit ("
+                               SIZE_FORMAT "M)", ZMarkStackSpaceLimit / M);
+    }
+
+    Atomic::store(&_spilled, new_size - ZMarkStackSpaceLimit);
   }
 
   log_debug(gc, marking)("Expanding mark stack space: " SIZE_FORMAT "M->" SIZE_FORMAT "M",
@@ -93,9 +112,9 @@ size_t ZMarkStackSpace::expand_space() {
 }
 
 size_t ZMarkStackSpace::shrink_space() {
-  // Shrink to what is currently used
+  // Shrink to what is currently used, but always release the spill space
   const size_t old_size = size();
-  const size_t new_size = align_up(used(), ZMarkStackSpaceExpandSize);
+  const size_t new_size = MIN2(align_up(used(), ZMarkStackSpaceExpandSize), (size_t)ZMarkStackSpaceLimit);
   const size_t shrink_size = old_size - new_size;
 
   if (shrink_size > 0) {
@@ -166,6 +185,7 @@ uintptr_t ZMarkStackSpace::alloc(size_t size) {
 void ZMarkStackSpace::free() {
   _end -= shrink_space();
   _top = _start;
+  _spilled = 0;
 }
 
 ZMarkStackAllocator::ZMarkStackAllocator()
@@ -185,6 +205,10 @@ size_t ZMarkStackAllocator::size() const {
   return _space.size();
 }
 
+size_t ZMarkStackAllocator::spilled() const {
+  return _space.spilled();
+}
+
 ZMarkStackMagazine* ZMarkStackAllocator::create_magazine_from_space(uintptr_t addr, size_t size) {
   assert(is_aligned(size, ZMarkStackSize), "Invalid size");
 
@@ -36,6 +36,8 @@ class ZMarkStackSpace {
   volatile uintptr_t _top;
   volatile uintptr_t _end;
   volatile bool      _recently_expanded;
+  size_t             _reserved;
+  volatile size_t    _spilled;
 
   size_t used() const;
 
@@ -52,6 +54,7 @@ class ZMarkStackSpace {
 
   uintptr_t start() const;
   size_t size() const;
+  size_t spilled() const;
 
   uintptr_t alloc(size_t size);
   void free();
@@ -72,6 +75,7 @@ class ZMarkStackAllocator : public CHeapObj<mtGC> {
 
   uintptr_t start() const;
   size_t size() const;
+  size_t spilled() const;
 
   bool clear_and_get_expanded_recently();
 
@@ -288,6 +288,14 @@ void ZNMethod::nmethod_oops_do_inner(nmethod* nm, OopClosure* cl) {
   }
 }
 
+bool ZNMethod::has_young_oops(nmethod* nm) {
+  return gc_data(nm)->has_young_oops();
+}
+
+void ZNMethod::set_has_young_oops(nmethod* nm, bool value) {
+  gc_data(nm)->set_has_young_oops(value);
+}
+
 void ZNMethod::nmethods_do_begin(bool secondary) {
   ZNMethodTable::nmethods_do_begin(secondary);
 }
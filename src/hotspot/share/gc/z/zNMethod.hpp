@@ -58,6 +58,9 @@ class ZNMethod : public AllStatic {
   static void nmethod_oops_do(nmethod* nm, OopClosure* cl);
   static void nmethod_oops_do_inner(nmethod* nm, OopClosure* cl);
 
+  static bool has_young_oops(nmethod* nm);
+  static void set_has_young_oops(nmethod* nm, bool value);
+
   static void nmethods_do_begin(bool secondary);
   static void nmethods_do_end(bool secondary);
   static void nmethods_do(bool secondary, NMethodClosure* cl);
@@ -31,7 +31,8 @@ ZNMethodData::ZNMethodData()
     _ic_lock(),
     _barriers(),
     _immediate_oops(),
-    _has_non_immediate_oops(false) {}
+    _has_non_immediate_oops(false),
+    _has_young_oops(true) {}
 
 ZReentrantLock* ZNMethodData::lock() {
   return &_lock;
@@ -56,6 +57,16 @@ bool ZNMethodData::has_non_immediate_oops() const {
   return _has_non_immediate_oops;
 }
 
+bool ZNMethodData::has_young_oops() const {
+  assert(_lock.is_owned(), "Should be owned");
+  return _has_young_oops;
+}
+
+void ZNMethodData::set_has_young_oops(bool value) {
+  assert(_lock.is_owned(), "Should be owned");
+  _has_young_oops = value;
+}
+
 void ZNMethodData::swap(ZArray<ZNMethodDataBarrier>* barriers,
                         ZArray<oop*>* immediate_oops,
                         bool has_non_immediate_oops) {
@@ -63,4 +74,8 @@ void ZNMethodData::swap(ZArray<ZNMethodDataBarrier>* barriers,
   _barriers.swap(barriers);
   _immediate_oops.swap(immediate_oops);
   _has_non_immediate_oops = has_non_immediate_oops;
+
+  // The oops might have been patched, so conservatively assume
+  // that the nmethod again refers to young objects.
+  _has_young_oops = true;
 }
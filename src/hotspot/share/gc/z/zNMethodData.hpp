@@ -42,6 +42,7 @@ class ZNMethodData : public CHeapObj<mtGC> {
   ZArray<ZNMethodDataBarrier> _barriers;
   ZArray<oop*>                _immediate_oops;
   bool                        _has_non_immediate_oops;
+  bool                        _has_young_oops;
 
 public:
   ZNMethodData();
@@ -53,6 +54,9 @@ class ZNMethodData : public CHeapObj<mtGC> {
   const ZArray<oop*>* immediate_oops() const;
   bool has_non_immediate_oops() const;
 
+  bool has_young_oops() const;
+  void set_has_young_oops(bool value);
+
   void swap(ZArray<ZNMethodDataBarrier>* barriers,
             ZArray<oop*>* immediate_oops,
             bool has_non_immediate_oops);
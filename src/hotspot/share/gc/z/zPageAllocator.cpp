@@ -189,6 +189,7 @@ ZPageAllocator::ZPageAllocator(size_t min_capacity,
     _initial_capacity(initial_capacity),
     _max_capacity(max_capacity),
     _current_max_capacity(max_capacity),
+    _memory_pressure_max_capacity(max_capacity),
     _capacity(0),
     _claimed(0),
     _used(0),
@@ -296,7 +297,22 @@ size_t ZPageAllocator::soft_max_capacity() const {
   // Note that SoftMaxHeapSize is a manageable flag
   const size_t soft_max_capacity = Atomic::load(&SoftMaxHeapSize);
   const size_t current_max_capacity = Atomic::load(&_current_max_capacity);
-  return MIN2(soft_max_capacity, current_max_capacity);
+  const size_t memory_pressure_max_capacity = Atomic::load(&_memory_pressure_max_capacity);
+  return MIN3(soft_max_capacity, current_max_capacity, memory_pressure_max_capacity);
+}
+
+size_t ZPageAllocator::memory_pressure_max_capacity() const {
+  return Atomic::load(&_memory_pressure_max_capacity);
+}
+
+void ZPageAllocator::set_memory_pressure_max_capacity(size_t capacity) {
+  Atomic::store(&_memory_pressure_max_capacity, capacity);
+
+  if (capacity < Atomic::load(&_capacity)) {
+    // Uncommit memory above the new limit without waiting for
+    // the uncommit delay to expire
+    _uncommitter->wake_up();
+  }
 }
 
 size_t ZPageAllocator::capacity() const {
@@ -868,16 +884,22 @@ size_t ZPageAllocator::uncommit(uint64_t* timeout) {
     SuspendibleThreadSetJoiner sts_joiner;
     ZLocker<ZLock> locker(&_lock);
 
+    // Under memory pressure, memory above the memory pressure max capacity
+    // is uncommitted immediately, ignoring the uncommit delay.
+    const size_t memory_pressure_max_capacity = Atomic::load(&_memory_pressure_max_capacity);
+    const bool immediate = memory_pressure_max_capacity < _capacity;
+
     // Never uncommit below min capacity. We flush out and uncommit chunks at
     // a time (~0.8% of the max capacity, but at least one granule and at most
     // 256M), in case demand for memory increases while we are uncommitting.
-    const size_t retain = MAX2(_used, _min_capacity);
-    const size_t release = _capacity - retain;
+    const size_t retain = immediate ? MAX3(_used, _min_capacity, memory_pressure_max_capacity)
+                                    : MAX2(_used, _min_capacity);
+    const size_t release = _capacity - MIN2(_capacity, retain);
     const size_t limit = MIN2(align_up(_current_max_capacity >> 7, ZGranuleSize), 256 * M);
     const size_t flush = MIN2(release, limit);
 
     // Flush pages to uncommit
-    flushed = _cache.flush_for_uncommit(flush, &pages, timeout);
+    flushed = _cache.flush_for_uncommit(flush, &pages, timeout, immediate);
     if (flushed == 0) {
       // Nothing flushed
       return 0;
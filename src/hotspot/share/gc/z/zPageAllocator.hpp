@@ -72,6 +72,7 @@ class ZPageAllocator {
   const size_t               _initial_capacity;
   const size_t               _max_capacity;
   volatile size_t            _current_max_capacity;
+  volatile size_t            _memory_pressure_max_capacity;
   volatile size_t            _capacity;
   volatile size_t            _claimed;
   volatile size_t            _used;
@@ -137,6 +138,8 @@ class ZPageAllocator {
   size_t min_capacity() const;
   size_t max_capacity() const;
   size_t soft_max_capacity() const;
+  size_t memory_pressure_max_capacity() const;
+  void set_memory_pressure_max_capacity(size_t capacity);
   size_t capacity() const;
   size_t used() const;
   size_t used_generation(ZGenerationId id) const;
@@ -58,7 +58,7 @@ class ZPageCache {
   void free_page(ZPage* page);
 
   void flush_for_allocation(size_t requested, ZList<ZPage>* to);
-  size_t flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64_t* timeout);
+  size_t flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64_t* timeout, bool immediate);
 
   void set_last_commit();
 };
@@ -263,6 +263,13 @@ void ZPhysicalMemoryManager::try_enable_uncommit(size_t min_capacity, size_t max
     return;
   }
 
+  if (ZReserveLargePages) {
+    // Uncommitting would return the reserved large pages to the pool
+    log_info_p(gc, init)("Uncommit: Implicitly Disabled (-XX:+ZReserveLargePages)");
+    FLAG_SET_ERGO(ZUncommit, false);
+    return;
+  }
+
   // Test if uncommit is supported by the operating system by committing
   // and then uncommitting a granule.
   ZPhysicalMemory pmem(ZPhysicalMemorySegment(zoffset(0), ZGranuleSize, false /* committed */));
@@ -42,9 +42,11 @@
 #include "gc/z/zStackWatermark.hpp"
 #include "gc/z/zStat.hpp"
 #include "gc/z/zTask.hpp"
+#include "gc/z/zThreadLocalData.hpp"
 #include "gc/z/zUncoloredRoot.inline.hpp"
 #include "gc/z/zVerify.hpp"
 #include "gc/z/zWorkers.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "prims/jvmtiTagMap.hpp"
 #include "runtime/atomic.hpp"
 #include "utilities/debug.hpp"
@@ -129,8 +131,9 @@ void ZRelocateQueue::leave() {
   }
 }
 
-void ZRelocateQueue::add_and_wait(ZForwarding* forwarding) {
+void ZRelocateQueue::add_and_wait(ZForwarding* forwarding, size_t relocated, bool budget_exhausted) {
   ZStatTimer timer(ZCriticalPhaseRelocationStall);
+  EventZRelocationStall event;
   ZLocker<ZConditionLock> locker(&_lock);
 
   if (forwarding->is_done()) {
@@ -147,6 +150,9 @@ void ZRelocateQueue::add_and_wait(ZForwarding* forwarding) {
   while (!forwarding->is_done()) {
     _lock.wait();
   }
+
+  // Send event
+  event.commit((u8)forwarding->type(), untype(ZOffset::address(forwarding->start())), forwarding->size(), relocated, budget_exhausted);
 }
 
 bool ZRelocateQueue::prune() {
@@ -349,6 +355,10 @@ static zaddress relocate_object_inner(ZForwarding* forwarding, zaddress from_add
   return to_addr_final;
 }
 
+static bool has_relocation_budget(Thread* thread) {
+  return ZMutatorRelocationBudget > 0 && thread->is_Java_thread();
+}
+
 zaddress ZRelocate::relocate_object(ZForwarding* forwarding, zaddress_unsafe from_addr) {
   ZForwardingCursor cursor;
 
@@ -359,6 +369,18 @@ zaddress ZRelocate::relocate_object(ZForwarding* forwarding, zaddress_unsafe fro
     return to_addr;
   }
 
+  Thread* const thread = Thread::current();
+  const ZGenerationId id = _generation->id();
+  const uint32_t seqnum = _generation->seqnum();
+  const size_t relocated = has_relocation_budget(thread) ? ZThreadLocalData::relocated_bytes(thread, id, seqnum) : 0;
+
+  if (has_relocation_budget(thread) && relocated >= ZMutatorRelocationBudget) {
+    // Budget exhausted. Signal and wait for a worker thread to complete
+    // relocation of this page, and then forward the object.
+    _queue.add_and_wait(forwarding, relocated, true /* budget_exhausted */);
+    return forward_object(forwarding, from_addr);
+  }
+
   // Relocate object
   if (forwarding->retain_page(&_queue)) {
     assert(_generation->is_phase_relocate(), "Must be");
@@ -367,12 +389,15 @@ zaddress ZRelocate::relocate_object(ZForwarding* forwarding, zaddress_unsafe fro
 
     if (!is_null(to_addr)) {
       // Success
+      if (has_relocation_budget(thread)) {
+        ZThreadLocalData::add_relocated_bytes(thread, id, seqnum, ZUtils::object_size(to_addr));
+      }
       return to_addr;
     }
 
     // Failed to relocate object. Signal and wait for a worker thread to
     // complete relocation of this page, and then forward the object.
-    _queue.add_and_wait(forwarding);
+    _queue.add_and_wait(forwarding, relocated, false /* budget_exhausted */);
   }
 
   // Forward object
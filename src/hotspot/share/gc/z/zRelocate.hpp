@@ -62,7 +62,7 @@ class ZRelocateQueue {
   void resize_workers(uint nworkers);
   void leave();
 
-  void add_and_wait(ZForwarding* forwarding);
+  void add_and_wait(ZForwarding* forwarding, size_t relocated, bool budget_exhausted);
 
   ZForwarding* synchronize_poll();
   void synchronize_thread();
@@ -55,6 +55,7 @@ ZRelocationSetSelectorGroup::ZRelocationSetSelectorGroup(const char* name,
     _live_pages(),
     _not_selected_pages(),
     _forwarding_entries(0),
+    _relocation_cost(0),
     _stats() {}
 
 bool ZRelocationSetSelectorGroup::is_disabled() {
@@ -108,7 +109,27 @@ void ZRelocationSetSelectorGroup::semi_sort() {
   _live_pages.swap(&sorted_live_pages);
 }
 
-void ZRelocationSetSelectorGroup::select_inner() {
+static int compare_relocation_cost(ZPage** p1, ZPage** p2) {
+  // Compare the predicted relocation cost per reclaimed byte. All
+  // candidate pages have garbage, so the divisors are never zero.
+  const double cost1 = (double)ZRelocationSetSelectorGroup::relocation_cost(*p1) / (double)((*p1)->size() - (*p1)->live_bytes());
+  const double cost2 = (double)ZRelocationSetSelectorGroup::relocation_cost(*p2) / (double)((*p2)->size() - (*p2)->live_bytes());
+
+  if (cost1 < cost2) {
+    return -1;
+  } else if (cost1 > cost2) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+void ZRelocationSetSelectorGroup::cost_sort() {
+  // Sort live pages by predicted relocation cost per reclaimed byte in ascending order
+  _live_pages.sort(compare_relocation_cost);
+}
+
+void ZRelocationSetSelectorGroup::select_inner(size_t* cost_budget) {
   // Calculate the number of pages to relocate by successively including pages in
   // a candidate relocation set and calculate the maximum space requirement for
   // their live objects.
@@ -118,11 +139,17 @@ void ZRelocationSetSelectorGroup::select_inner() {
   size_t npages_selected[ZPageAgeMax + 1] = { 0 };
   size_t selected_live_bytes[ZPageAgeMax + 1] = { 0 };
   size_t selected_forwarding_entries = 0;
+  size_t selected_relocation_cost = 0;
 
   size_t from_live_bytes = 0;
   size_t from_forwarding_entries = 0;
+  size_t from_relocation_cost = 0;
 
-  semi_sort();
+  if (ZRelocationCostModel) {
+    cost_sort();
+  } else {
+    semi_sort();
+  }
 
   for (int from = 1; from <= npages; from++) {
     // Add page to the candidate relocation set
@@ -130,6 +157,16 @@ void ZRelocationSetSelectorGroup::select_inner() {
     const size_t page_live_bytes = page->live_bytes();
     from_live_bytes += page_live_bytes;
     from_forwarding_entries += ZForwarding::nentries(page);
+    from_relocation_cost += relocation_cost(page);
+
+    if (from_relocation_cost > *cost_budget) {
+      // The candidate relocation set is not predicted to be
+      // relocated within the time budget. Since the pages are
+      // sorted by cost, no later candidate is a better choice.
+      log_trace(gc, reloc)("Candidate Relocation Set (%s Pages): %d, exceeds cost budget",
+                           _name, from);
+      break;
+    }
 
     // Calculate the maximum number of pages needed by the candidate relocation set.
     // By subtracting the object size limit from the pages size we get the maximum
@@ -150,6 +187,7 @@ void ZRelocationSetSelectorGroup::select_inner() {
       selected_live_bytes[static_cast<uint>(page->age())] += page_live_bytes;
       npages_selected[static_cast<uint>(page->age())] += 1;
       selected_forwarding_entries = from_forwarding_entries;
+      selected_relocation_cost = from_relocation_cost;
     }
 
     log_trace(gc, reloc)("Candidate Relocation Set (%s Pages): %d->%d, "
@@ -168,6 +206,8 @@ void ZRelocationSetSelectorGroup::select_inner() {
   }
   _live_pages.trunc_to(selected_from);
   _forwarding_entries = selected_forwarding_entries;
+  _relocation_cost = selected_relocation_cost;
+  *cost_budget -= selected_relocation_cost;
 
   // Update statistics
   for (uint i = 0; i <= ZPageAgeMax; ++i) {
@@ -179,7 +219,7 @@ void ZRelocationSetSelectorGroup::select_inner() {
                        _name, selected_from, selected_to, npages - selected_from, selected_forwarding_entries);
 }
 
-void ZRelocationSetSelectorGroup::select() {
+void ZRelocationSetSelectorGroup::select(size_t* cost_budget) {
   if (is_disabled()) {
     return;
   }
@@ -187,7 +227,7 @@ void ZRelocationSetSelectorGroup::select() {
   EventZRelocationSetGroup event;
 
   if (is_selectable()) {
-    select_inner();
+    select_inner(cost_budget);
   } else {
     // Mark pages as not selected
     const int npages = _live_pages.length();
@@ -210,11 +250,12 @@ void ZRelocationSetSelectorGroup::select() {
   event.commit((u8)_page_type, s._npages_candidates, s._total, s._empty, s._npages_selected, s._relocate);
 }
 
-ZRelocationSetSelector::ZRelocationSetSelector(double fragmentation_limit)
+ZRelocationSetSelector::ZRelocationSetSelector(double fragmentation_limit, size_t cost_budget)
   : _small("Small", ZPageType::small, ZPageSizeSmall, ZObjectSizeLimitSmall, fragmentation_limit),
     _medium("Medium", ZPageType::medium, ZPageSizeMedium, ZObjectSizeLimitMedium, fragmentation_limit),
     _large("Large", ZPageType::large, 0 /* page_size */, 0 /* object_size_limit */, fragmentation_limit),
-    _empty_pages() {}
+    _empty_pages(),
+    _cost_budget(cost_budget) {}
 
 void ZRelocationSetSelector::select() {
   // Select pages to relocate. The resulting relocation set will be
@@ -226,9 +267,9 @@ void ZRelocationSetSelector::select() {
   EventZRelocationSet event;
 
   // Select pages from each group
-  _large.select();
-  _medium.select();
-  _small.select();
+  _large.select(&_cost_budget);
+  _medium.select(&_cost_budget);
+  _small.select(&_cost_budget);
 
   // Send event
   event.commit(total(), empty(), relocate());
@@ -87,12 +87,14 @@ class ZRelocationSetSelectorGroup {
   ZArray<ZPage*>                   _live_pages;
   ZArray<ZPage*>                   _not_selected_pages;
   size_t                           _forwarding_entries;
+  size_t                           _relocation_cost;
   ZRelocationSetSelectorGroupStats _stats[ZPageAgeMax + 1];
 
   bool is_disabled();
   bool is_selectable();
   void semi_sort();
-  void select_inner();
+  void cost_sort();
+  void select_inner(size_t* cost_budget);
 
 public:
   ZRelocationSetSelectorGroup(const char* name,
@@ -101,14 +103,19 @@ class ZRelocationSetSelectorGroup {
                               size_t object_size_limit,
                               double fragmentation_limit);
 
+  // Predicted cost of relocating the live objects of a page,
+  // in units of relocated bytes
+  static size_t relocation_cost(const ZPage* page);
+
   void register_live_page(ZPage* page);
   void register_empty_page(ZPage* page);
-  void select();
+  void select(size_t* cost_budget);
 
   const ZArray<ZPage*>* live_pages() const;
   const ZArray<ZPage*>* selected_pages() const;
   const ZArray<ZPage*>* not_selected_pages() const;
   size_t forwarding_entries() const;
+  size_t relocation_cost() const;
 
   const ZRelocationSetSelectorGroupStats& stats(ZPageAge age) const;
 };
@@ -119,13 +126,14 @@ class ZRelocationSetSelector : public StackObj {
   ZRelocationSetSelectorGroup _medium;
   ZRelocationSetSelectorGroup _large;
   ZArray<ZPage*>              _empty_pages;
+  size_t                      _cost_budget;
 
   size_t total() const;
   size_t empty() const;
   size_t relocate() const;
 
 public:
-  ZRelocationSetSelector(double fragmentation_limit);
+  ZRelocationSetSelector(double fragmentation_limit, size_t cost_budget = SIZE_MAX);
 
   void register_live_page(ZPage* page);
   void register_empty_page(ZPage* page);
@@ -143,6 +151,7 @@ class ZRelocationSetSelector : public StackObj {
   const ZArray<ZPage*>* not_selected_medium() const;
   const ZArray<ZPage*>* not_selected_large() const;
   size_t forwarding_entries() const;
+  size_t relocation_cost() const;
 
   ZRelocationSetSelectorStats stats() const;
 };
@@ -69,6 +69,14 @@ inline const ZRelocationSetSelectorGroupStats& ZRelocationSetSelectorStats::larg
   return _large[static_cast<uint>(age)];
 }
 
+inline size_t ZRelocationSetSelectorGroup::relocation_cost(const ZPage* page) {
+  // Besides copying the live bytes, each live object needs a forwarding
+  // entry to be inserted and its fields to be visited, which makes many
+  // small objects more costly to relocate than a few large ones.
+  const size_t object_cost = 64;
+  return page->live_bytes() + (size_t)page->live_objects() * object_cost;
+}
+
 inline void ZRelocationSetSelectorGroup::register_live_page(ZPage* page) {
   const size_t size = page->size();
   const size_t live = page->live_bytes();
@@ -108,6 +116,10 @@ inline size_t ZRelocationSetSelectorGroup::forwarding_entries() const {
   return _forwarding_entries;
 }
 
+inline size_t ZRelocationSetSelectorGroup::relocation_cost() const {
+  return _relocation_cost;
+}
+
 inline const ZRelocationSetSelectorGroupStats& ZRelocationSetSelectorGroup::stats(ZPageAge age) const {
   return _stats[static_cast<uint>(age)];
 }
@@ -205,4 +217,8 @@ inline size_t ZRelocationSetSelector::forwarding_entries() const {
   return _small.forwarding_entries() + _medium.forwarding_entries();
 }
 
+inline size_t ZRelocationSetSelector::relocation_cost() const {
+  return _small.relocation_cost() + _medium.relocation_cost();
+}
+
 #endif // SHARE_GC_Z_ZRELOCATIONSETSELECTOR_INLINE_HPP
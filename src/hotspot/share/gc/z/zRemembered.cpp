@@ -571,6 +571,30 @@ void ZRemembered::scan_and_follow(ZMark* mark) {
   mark->mark_follow();
 }
 
+void ZRemembered::remember(volatile zpointer** fields, size_t count) const {
+  ZPage* page = nullptr;
+  volatile zpointer* prev = nullptr;
+
+  for (size_t i = 0; i < count; i++) {
+    volatile zpointer* const p = fields[i];
+    assert(prev <= p, "Fields must be sorted");
+
+    if (p == prev) {
+      // Already remembered
+      continue;
+    }
+
+    if (page == nullptr || !page->is_in(to_zaddress((uintptr_t)p))) {
+      // Sorted fields in the same page are adjacent
+      page = _page_table->get(p);
+      assert(page != nullptr,  "Page missing in page table");
+    }
+
+    page->remember(p);
+    prev = p;
+  }
+}
+
 bool ZRemembered::scan_field(volatile zpointer* p) const {
   assert(ZGeneration::young()->is_phase_mark(), "Wrong phase");
 
@@ -84,6 +84,9 @@ class ZRemembered {
   // Add to remembered set
   void remember(volatile zpointer* p) const;
 
+  // Add a batch of fields, sorted by address, to the remembered set
+  void remember(volatile zpointer** fields, size_t count) const;
+
   // Scan all remembered sets and follow
   void scan_and_follow(ZMark* mark);
 
@@ -1420,7 +1420,8 @@ ZStatMark::ZStatMark()
     _nterminateflush(),
     _ntrycomplete(),
     _ncontinue(),
-    _mark_stack_usage() {}
+    _mark_stack_usage(),
+    _mark_stack_spilled() {}
 
 void ZStatMark::at_mark_start(size_t nstripes) {
   _nstripes = nstripes;
@@ -1436,8 +1437,9 @@ void ZStatMark::at_mark_end(size_t nproactiveflush,
   _ncontinue = ncontinue;
 }
 
-void ZStatMark::at_mark_free(size_t mark_stack_usage) {
+void ZStatMark::at_mark_free(size_t mark_stack_usage, size_t mark_stack_spilled) {
   _mark_stack_usage = mark_stack_usage;
+  _mark_stack_spilled = mark_stack_spilled;
 }
 
 void ZStatMark::print() {
@@ -1454,6 +1456,10 @@ void ZStatMark::print() {
                         _ncontinue);
 
   log_info(gc, marking)("Mark Stack Usage: " SIZE_FORMAT "M", _mark_stack_usage / M);
+
+  if (_mark_stack_spilled > 0) {
+    log_info(gc, marking)("Mark Stack Spilled: " SIZE_FORMAT "M", _mark_stack_spilled / M);
+  }
 }
 
 //
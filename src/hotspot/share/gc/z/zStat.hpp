@@ -496,6 +496,7 @@ class ZStatMark {
   size_t _ntrycomplete;
   size_t _ncontinue;
   size_t _mark_stack_usage;
+  size_t _mark_stack_spilled;
 
 public:
   ZStatMark();
@@ -505,7 +506,7 @@ class ZStatMark {
                    size_t nterminateflush,
                    size_t ntrycomplete,
                    size_t ncontinue);
-  void at_mark_free(size_t mark_stack_usage);
+  void at_mark_free(size_t mark_stack_usage, size_t mark_stack_spilled);
 
   void print();
 };
@@ -31,6 +31,7 @@
 #include "memory/resourceArea.hpp"
 #include "runtime/threadSMR.hpp"
 #include "utilities/ostream.hpp"
+#include "utilities/quickSort.hpp"
 #include "utilities/vmError.hpp"
 
 ByteSize ZStoreBarrierEntry::p_offset() {
@@ -55,7 +56,9 @@ ZStoreBarrierBuffer::ZStoreBarrierBuffer()
     _last_installed_color(),
     _base_pointer_lock(),
     _base_pointers(),
-    _current(ZBufferStoreBarriers ? _buffer_size_bytes : 0) {}
+    _current(ZBufferStoreBarriers ? _buffer_min_length * sizeof(ZStoreBarrierEntry) : 0),
+    _capacity(_buffer_min_length),
+    _full_flushes(0) {}
 
 void ZStoreBarrierBuffer::initialize() {
   _last_processed_color = ZPointerStoreGoodMask;
@@ -63,11 +66,18 @@ void ZStoreBarrierBuffer::initialize() {
 }
 
 void ZStoreBarrierBuffer::clear() {
-  _current = _buffer_size_bytes;
+  _current = _capacity * sizeof(ZStoreBarrierEntry);
+}
+
+void ZStoreBarrierBuffer::resize(size_t capacity) {
+  assert(is_empty(), "Can only resize an empty buffer");
+  assert(capacity >= _buffer_min_length && capacity <= _buffer_max_length, "Invalid capacity");
+  _capacity = capacity;
+  clear();
 }
 
 bool ZStoreBarrierBuffer::is_empty() const {
-  return _current == _buffer_size_bytes;
+  return _current == _capacity * sizeof(ZStoreBarrierEntry);
 }
 
 void ZStoreBarrierBuffer::install_base_pointers_inner() {
@@ -79,7 +89,7 @@ void ZStoreBarrierBuffer::install_base_pointers_inner() {
          (ZPointer::remap_bits(_last_processed_color) & ZPointerRemappedOldMask) == 0,
          "Should not have double bit errors");
 
-  for (int i = current(); i < (int)_buffer_length; ++i) {
+  for (int i = current(); i < (int)_capacity; ++i) {
     const ZStoreBarrierEntry& entry = _buffer[i];
     volatile zpointer* const p = entry._p;
     const zaddress_unsafe p_unsafe = to_zaddress_unsafe((uintptr_t)p);
@@ -229,7 +239,7 @@ void ZStoreBarrierBuffer::on_new_phase() {
   // Install all base pointers for relocation
   install_base_pointers();
 
-  for (int i = current(); i < (int)_buffer_length; ++i) {
+  for (int i = current(); i < (int)_capacity; ++i) {
     on_new_phase_relocate(i);
     on_new_phase_remember(i);
     on_new_phase_mark(i);
@@ -237,6 +247,13 @@ void ZStoreBarrierBuffer::on_new_phase() {
 
   clear();
 
+  // Shrink buffers of threads that did not fill up their buffer
+  // during the last phase, to keep the phase change work down.
+  if (_full_flushes == 0 && _capacity > _buffer_min_length) {
+    resize(_capacity / 2);
+  }
+  _full_flushes = 0;
+
   _last_processed_color = ZPointerStoreGoodMask;
   assert(_last_installed_color == _last_processed_color, "invariant");
 }
@@ -259,7 +276,7 @@ void ZStoreBarrierBuffer::on_error(outputStream* st) {
   st->print_cr(" _last_processed_color: " PTR_FORMAT, _last_processed_color);
   st->print_cr(" _last_installed_color: " PTR_FORMAT, _last_installed_color);
 
-  for (int i = current(); i < (int)_buffer_length; ++i) {
+  for (int i = current(); i < (int)_capacity; ++i) {
     st->print_cr(" [%2d]: base: " PTR_FORMAT " p: " PTR_FORMAT " prev: " PTR_FORMAT,
         i,
         untype(_base_pointers[i]),
@@ -276,15 +293,63 @@ void ZStoreBarrierBuffer::flush() {
   OnError on_error(this);
   VMErrorCallbackMark mark(&on_error);
 
-  for (int i = current(); i < (int)_buffer_length; ++i) {
+  for (int i = current(); i < (int)_capacity; ++i) {
     const ZStoreBarrierEntry& entry = _buffer[i];
     const zaddress addr = ZBarrier::make_load_good(entry._prev);
-    ZBarrier::mark_and_remember(entry._p, addr);
+    if (!is_null(addr)) {
+      ZBarrier::mark<ZMark::DontResurrect, ZMark::AnyThread, ZMark::Follow, ZMark::Strong>(addr);
+    }
   }
 
+  remember_old_fields();
+
   clear();
 }
 
+static int compare_fields(volatile zpointer* a, volatile zpointer* b) {
+  if (a < b) {
+    return -1;
+  } else if (a > b) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+void ZStoreBarrierBuffer::remember_old_fields() {
+  // Collect the fields located in old pages
+  volatile zpointer* fields[_buffer_max_length];
+  size_t count = 0;
+
+  for (int i = current(); i < (int)_capacity; ++i) {
+    volatile zpointer* const p = _buffer[i]._p;
+    if (ZHeap::heap()->is_old(p)) {
+      fields[count++] = p;
+    }
+  }
+
+  if (count == 0) {
+    return;
+  }
+
+  // Sort the fields, so that the remembered set of each page is
+  // looked up once and fields stored to repeatedly are only
+  // remembered once.
+  QuickSort::sort(fields, count, compare_fields);
+
+  ZGeneration::young()->remember(fields, count);
+}
+
+void ZStoreBarrierBuffer::flush_full() {
+  flush();
+
+  // Grow the buffer of threads that frequently fill up their buffer
+  if (++_full_flushes >= _buffer_grow_flushes && _capacity < _buffer_max_length) {
+    resize(_capacity * 2);
+    _full_flushes = 0;
+  }
+}
+
 bool ZStoreBarrierBuffer::is_in(volatile zpointer* p) {
   if (!ZBufferStoreBarriers) {
     return false;
@@ -296,7 +361,7 @@ bool ZStoreBarrierBuffer::is_in(volatile zpointer* p) {
     const uintptr_t  last_remap_bits = ZPointer::remap_bits(buffer->_last_processed_color) & ZPointerRemappedMask;
     const bool needs_remap = last_remap_bits != ZPointerRemapped;
 
-    for (int i = buffer->current(); i < (int)_buffer_length; ++i) {
+    for (int i = buffer->current(); i < (int)buffer->_capacity; ++i) {
       const ZStoreBarrierEntry& entry = buffer->_buffer[i];
       volatile zpointer* entry_p = entry._p;
 
@@ -42,10 +42,15 @@ class ZStoreBarrierBuffer : public CHeapObj<mtGC> {
   friend class ZVerify;
 
 private:
-  static const size_t _buffer_length     = 32;
-  static const size_t _buffer_size_bytes = _buffer_length * sizeof(ZStoreBarrierEntry);
+  // The buffer capacity adapts between the min and max length, based on
+  // how often the buffer fills up between two phase changes.
+  static const size_t _buffer_min_length = 32;
+  static const size_t _buffer_max_length = 128;
 
-  ZStoreBarrierEntry _buffer[_buffer_length];
+  // Number of times a buffer can fill up within a phase before it grows
+  static const size_t _buffer_grow_flushes = 4;
+
+  ZStoreBarrierEntry _buffer[_buffer_max_length];
 
   // Color from previous phase this buffer was processed
   uintptr_t          _last_processed_color;
@@ -54,16 +59,25 @@ class ZStoreBarrierBuffer : public CHeapObj<mtGC> {
   uintptr_t          _last_installed_color;
 
   ZLock              _base_pointer_lock;
-  zaddress_unsafe    _base_pointers[_buffer_length];
+  zaddress_unsafe    _base_pointers[_buffer_max_length];
 
   // sizeof(ZStoreBarrierEntry) scaled index growing downwards
   size_t             _current;
 
+  // Number of entries currently in use, and the number of times
+  // the buffer filled up since the last phase change
+  size_t             _capacity;
+  size_t             _full_flushes;
+
   void on_new_phase_relocate(int i);
   void on_new_phase_remember(int i);
   void on_new_phase_mark(int i);
 
   void clear();
+  void resize(size_t capacity);
+  void flush_full();
+
+  void remember_old_fields();
 
   bool is_old_mark() const;
   bool stored_during_old_mark() const;
@@ -37,7 +37,7 @@ inline intptr_t ZStoreBarrierBuffer::current() const {
 inline void ZStoreBarrierBuffer::add(volatile zpointer* p, zpointer prev) {
   assert(ZBufferStoreBarriers, "Only buffer stores when it is enabled");
   if (_current == 0) {
-    flush();
+    flush_full();
   }
   _current -= sizeof(ZStoreBarrierEntry);
   _buffer[current()] = {p, prev};
@@ -44,6 +44,8 @@ class ZThreadLocalData {
   ZStoreBarrierBuffer*   _store_barrier_buffer;
   ZMarkThreadLocalStacks _mark_stacks[2];
   zaddress_unsafe*       _invisible_root;
+  size_t                 _relocated_bytes[2];
+  uint32_t               _relocated_bytes_seqnum[2];
 
   ZThreadLocalData()
     : _load_good_mask(0),
@@ -55,7 +57,9 @@ class ZThreadLocalData {
       _nmethod_disarmed(0),
       _store_barrier_buffer(new ZStoreBarrierBuffer()),
       _mark_stacks(),
-      _invisible_root(nullptr) {}
+      _invisible_root(nullptr),
+      _relocated_bytes(),
+      _relocated_bytes_seqnum() {}
 
   ~ZThreadLocalData() {
     delete _store_barrier_buffer;
@@ -120,6 +124,21 @@ class ZThreadLocalData {
     return data(thread)->_invisible_root;
   }
 
+  // Bytes relocated by the thread during GC cycle seqnum of the given generation
+  static size_t relocated_bytes(Thread* thread, ZGenerationId id, uint32_t seqnum) {
+    ZThreadLocalData* const data = ZThreadLocalData::data(thread);
+    return data->_relocated_bytes_seqnum[(int)id] == seqnum ? data->_relocated_bytes[(int)id] : 0;
+  }
+
+  static void add_relocated_bytes(Thread* thread, ZGenerationId id, uint32_t seqnum, size_t size) {
+    ZThreadLocalData* const data = ZThreadLocalData::data(thread);
+    if (data->_relocated_bytes_seqnum[(int)id] != seqnum) {
+      data->_relocated_bytes_seqnum[(int)id] = seqnum;
+      data->_relocated_bytes[(int)id] = 0;
+    }
+    data->_relocated_bytes[(int)id] += size;
+  }
+
   static ByteSize load_bad_mask_offset() {
     return Thread::gc_data_offset() + byte_offset_of(ZThreadLocalData, _load_bad_mask);
   }
@@ -35,22 +35,26 @@ static const ZStatCounter ZCounterUncommit("Memory", "Uncommit", ZStatUnitBytesP
 ZUncommitter::ZUncommitter(ZPageAllocator* page_allocator)
   : _page_allocator(page_allocator),
     _lock(),
-    _stop(false) {
+    _stop(false),
+    _wake_up(false) {
   set_name("ZUncommitter");
   create_and_start();
 }
 
-bool ZUncommitter::wait(uint64_t timeout) const {
+bool ZUncommitter::wait(uint64_t timeout) {
   ZLocker<ZConditionLock> locker(&_lock);
   while (!ZUncommit && !_stop) {
     _lock.wait();
   }
 
-  if (!_stop && timeout > 0) {
+  if (!_stop && !_wake_up && timeout > 0) {
     log_debug(gc, heap)("Uncommit Timeout: " UINT64_FORMAT "s", timeout);
     _lock.wait(timeout * MILLIUNITS);
   }
 
+  // A wake up that arrived before or during the wait has been handled.
+  _wake_up = false;
+
   return !_stop;
 }
 
@@ -89,6 +93,12 @@ void ZUncommitter::run_thread() {
   }
 }
 
+void ZUncommitter::wake_up() {
+  ZLocker<ZConditionLock> locker(&_lock);
+  _wake_up = true;
+  _lock.notify_all();
+}
+
 void ZUncommitter::terminate() {
   ZLocker<ZConditionLock> locker(&_lock);
   _stop = true;
@@ -34,8 +34,9 @@ class ZUncommitter : public ZThread {
   ZPageAllocator* const  _page_allocator;
   mutable ZConditionLock _lock;
   bool                   _stop;
+  bool                   _wake_up;
 
-  bool wait(uint64_t timeout) const;
+  bool wait(uint64_t timeout);
   bool should_continue() const;
 
 protected:
@@ -44,6 +45,8 @@ class ZUncommitter : public ZThread {
 
 public:
   ZUncommitter(ZPageAllocator* page_allocator);
+
+  void wake_up();
 };
 
 #endif // SHARE_GC_Z_ZUNCOMMITTER_HPP
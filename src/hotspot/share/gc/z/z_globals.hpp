@@ -47,6 +47,37 @@
   product(bool, ZCollectionIntervalOnly, false,                             \
           "Only use timers for GC heuristics")                              \
                                                                             \
+  product(double, ZMemoryPressureThreshold, 0.0, EXPERIMENTAL,              \
+          "Container memory pressure (in percent) above which the soft "    \
+          "max heap size is lowered, GC is triggered and unused memory is " \
+          "uncommitted immediately. The soft max heap size is also kept "   \
+          "within the container memory headroom. 0 disables")               \
+          range(0, 100)                                                     \
+                                                                            \
+  product(size_t, ZMutatorRelocationBudget, 0, EXPERIMENTAL,                \
+          "Maximum number of bytes a Java thread relocates per GC cycle "   \
+          "before it waits for GC workers to relocate the pages it "        \
+          "encounters. 0 means unlimited")                                  \
+                                                                            \
+  product(bool, ZReserveLargePages, false, EXPERIMENTAL,                    \
+          "Reserve large pages for the max heap size from the hugetlbfs "   \
+          "pool at startup and retain them, instead of reserving them "     \
+          "when memory is committed. Disables uncommit. Only supported "    \
+          "on Linux with -XX:+UseLargePages")                               \
+                                                                            \
+  product(bool, ZRelocationCostModel, false, EXPERIMENTAL,                  \
+          "Rank relocation candidate pages by reclaimed bytes per "         \
+          "predicted relocation time, and limit the relocation set to "     \
+          "what is predicted to be relocated before the heap runs out at "  \
+          "the current allocation rate")                                    \
+                                                                            \
+  product(size_t, ZMarkStackSpillLimit, 1*G, EXPERIMENTAL,                  \
+          "Maximum number of bytes allocated for mark stacks beyond "       \
+          "ZMarkStackSpaceLimit. Spilled mark stack memory is only used "   \
+          "when the regular mark stack space is exhausted, and is "         \
+          "released when marking ends")                                     \
+          range(0, 1024*G)                                                  \
+                                                                            \
   product(bool, ZBufferStoreBarriers, true, DIAGNOSTIC,                     \
           "Buffer store barriers")                                          \
                                                                             \
@@ -71,6 +102,13 @@
           "Young generation tenuring threshold, -1 for dynamic computation")\
           range(-1, static_cast<int>(ZPageAgeMax))                          \
                                                                             \
+  product(double, ZEarlyPromotionSurvivalRate, 0.0, EXPERIMENTAL,           \
+          "Promote young objects at the lowest survivor age at which at "   \
+          "least this percentage of the live bytes survive the next young " \
+          "collection, if below the computed tenuring threshold. "          \
+          "0 disables")                                                     \
+          range(0, 100)                                                     \
+                                                                            \
   develop(size_t, ZForceDiscontiguousHeapReservations, 0,                   \
           "The gc will attempt to split the heap reservation into this "    \
           "many reservations, subject to available virtual address space "  \
@@ -60,6 +60,7 @@
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/os.hpp"
 #include "runtime/os_perf.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threads.hpp"
 #include "runtime/vmThread.hpp"
@@ -574,6 +575,23 @@ TRACE_REQUEST_FUNC(GCHeapMemoryPoolUsage) {
 }
 
 
+TRACE_REQUEST_FUNC(SafepointLatencyHistogram) {
+  for (int i = 0; i < SafepointTracing::histogram_bucket_count(); i++) {
+    uint64_t sync_count = SafepointTracing::sync_time_count(i);
+    uint64_t vmop_count = SafepointTracing::vmop_time_count(i);
+    if (sync_count == 0 && vmop_count == 0) {
+      continue;
+    }
+    EventSafepointLatencyHistogram event(UNTIMED);
+    event.set_lowerBound(SafepointTracing::histogram_bucket_low_us(i) * (NANOUNITS / MICROUNITS));
+    event.set_synchronizationCount(sync_count);
+    event.set_operationCount(vmop_count);
+    event.set_starttime(timestamp());
+    event.set_endtime(timestamp());
+    event.commit();
+  }
+}
+
 TRACE_REQUEST_FUNC(ClassLoadingStatistics) {
 #if INCLUDE_MANAGEMENT
   EventClassLoadingStatistics event;
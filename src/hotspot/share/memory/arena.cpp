@@ -318,14 +318,9 @@ void *Arena::Arealloc(void* old_ptr, size_t old_size, size_t new_size, AllocFail
     return c_old;
   }
 
-  // make sure that new_size is legal
-  size_t corrected_new_size = ARENA_ALIGN(new_size);
-
   // See if we can resize in-place
-  if( (c_old+old_size == _hwm) &&       // Adjusting recent thing
-      (c_old+corrected_new_size <= _max) ) {      // Still fits where it sits
-    _hwm = c_old+corrected_new_size;      // Adjust hwm
-    return c_old;               // Return old pointer
+  if (Agrow_in_place(c_old, old_size, new_size)) {
+    return c_old;
   }
 
   // Oops, got to relocate guts
@@ -170,6 +170,19 @@ class Arena : public CHeapObjBase {
   void *Arealloc( void *old_ptr, size_t old_size, size_t new_size,
       AllocFailType alloc_failmode = AllocFailStrategy::EXIT_OOM);
 
+  // Grow the most recent Amalloc allocation in place, if the new size still
+  // fits in the current chunk. Returns false, and leaves the arena unchanged,
+  // if ptr is not the most recent allocation or there is not enough room.
+  bool Agrow_in_place(void* ptr, size_t old_size, size_t new_size) {
+    char* c_ptr = (char*)ptr;
+    if (c_ptr + ARENA_ALIGN(old_size) == _hwm &&
+        pointer_delta(_max, c_ptr, 1) >= ARENA_ALIGN(new_size)) {
+      _hwm = c_ptr + ARENA_ALIGN(new_size);
+      return true;
+    }
+    return false;
+  }
+
   // Determine if pointer belongs to this Arena or not.
   bool contains( const void *ptr ) const;
 
@@ -41,6 +41,7 @@ CodeHeap::CodeHeap(const char* name, const CodeBlobType code_blob_type)
   _number_of_reserved_segments  = 0;
   _segment_size                 = 0;
   _log2_segment_size            = 0;
+  _page_size                    = 0;
   _next_segment                 = 0;
   _freelist                     = nullptr;
   _last_insert_point            = nullptr;
@@ -209,6 +210,7 @@ bool CodeHeap::reserve(ReservedSpace rs, size_t committed_size, size_t segment_s
 
   // Reserve and initialize space for _memory.
   const size_t page_size = rs.page_size();
+  _page_size = page_size;
   const size_t granularity = os::vm_allocation_granularity();
   const size_t c_size = align_up(committed_size, page_size);
   assert(c_size <= rs.size(), "alignment made committed size to large");
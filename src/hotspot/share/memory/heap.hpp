@@ -91,6 +91,7 @@ class CodeHeap : public CHeapObj<mtCode> {
   size_t       _number_of_reserved_segments;
   size_t       _segment_size;
   int          _log2_segment_size;
+  size_t       _page_size;                       // page size backing _memory
 
   size_t       _next_segment;
 
@@ -179,6 +180,7 @@ class CodeHeap : public CHeapObj<mtCode> {
   static size_t header_size()         { return sizeof(HeapBlock); } // returns the header size for each heap block
 
   size_t segment_size()         const { return _segment_size; }  // for CodeHeapState
+  size_t page_size()            const { return _page_size; }
   HeapBlock* first_block() const;                                // for CodeHeapState
   HeapBlock* next_block(HeapBlock* b) const;                     // for CodeHeapState
   HeapBlock* split_block(HeapBlock* b, size_t split_seg);        // split one block into two
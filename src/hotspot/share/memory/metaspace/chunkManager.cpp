@@ -251,6 +251,20 @@ void ChunkManager::return_chunk(Metachunk* c) {
   return_chunk_locked(c);
 }
 
+// See return_chunks().
+void ChunkManager::return_chunks(Metachunk* c) {
+  MutexLocker fcl(Metaspace_lock, Mutex::_no_safepoint_check_flag);
+  while (c != nullptr) {
+    Metachunk* next = c->next();
+    DEBUG_ONLY(c->set_prev(nullptr);)
+    DEBUG_ONLY(c->set_next(nullptr);)
+    ASAN_POISON_MEMORY_REGION(c->base(), c->word_size() * BytesPerWord);
+    return_chunk_locked(c);
+    // c may be invalid after return_chunk_locked(c) was called. Don't access anymore.
+    c = next;
+  }
+}
+
 // See return_chunk().
 void ChunkManager::return_chunk_locked(Metachunk* c) {
   assert_lock_strong(Metaspace_lock);
@@ -136,6 +136,11 @@ class ChunkManager : public CHeapObj<mtMetaspace> {
   //       calling this method.
   void return_chunk(Metachunk* c);
 
+  // Return all chunks of a chain linked via next(), starting at c, as if by
+  //  calling return_chunk() for each of them, but taking the lock only once.
+  //  The same notes as for return_chunk() apply to all chunks in the chain.
+  void return_chunks(Metachunk* c);
+
   // Given a chunk c, which must be "in use" and must not be a root chunk, attempt to
   // enlarge it in place by claiming its trailing buddy.
   //
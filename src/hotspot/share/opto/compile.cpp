@@ -255,6 +255,7 @@ void Compile::print_statistics() {
     if (xtty != nullptr)  xtty->head("statistics type='opto'");
     Parse::print_statistics();
     PhaseStringOpts::print_statistics();
+    PhaseIterGVN::print_statistics();
     PhaseCCP::print_statistics();
     PhaseRegAlloc::print_statistics();
     PhaseOutput::print_statistics();
@@ -884,6 +884,51 @@ void PhaseIterGVN::verify_step(Node* n) {
   }
 }
 
+uint PhaseIterGVN::_total_processed[_last_opcode] = { 0 };
+uint PhaseIterGVN::_total_unchanged[_last_opcode] = { 0 };
+
+void PhaseIterGVN::record_processed(int opcode, bool progress) {
+  assert(opcode >= 0 && opcode < _last_opcode, "opcode out of range: %d", opcode);
+  _total_processed[opcode]++;
+  if (!progress) {
+    _total_unchanged[opcode]++;
+  }
+}
+
+// Print the node types IGVN spends the most worklist pops on. A high
+// unchanged share points at nodes that are pushed again without anything
+// relevant to them having changed.
+void PhaseIterGVN::print_statistics() {
+  const int max_lines = 20;
+  julong total = 0;
+  julong unchanged = 0;
+  for (int i = 0; i < _last_opcode; i++) {
+    total += _total_processed[i];
+    unchanged += _total_unchanged[i];
+  }
+  if (total == 0) {
+    return;
+  }
+  tty->print_cr("IterGVN: " JULONG_FORMAT " nodes processed, " JULONG_FORMAT " unchanged (%.1f%%)",
+                total, unchanged, 100.0 * (double)unchanged / (double)total);
+  bool printed[_last_opcode] = { false };
+  for (int line = 0; line < max_lines; line++) {
+    int top = 0;
+    for (int i = 1; i < _last_opcode; i++) {
+      if (!printed[i] && _total_processed[i] > _total_processed[top]) {
+        top = i;
+      }
+    }
+    if (_total_processed[top] == 0) {
+      break;
+    }
+    printed[top] = true;
+    tty->print_cr("  %-20s %10u processed %10u unchanged (%.1f%%)",
+                  NodeClassNames[top], _total_processed[top], _total_unchanged[top],
+                  100.0 * (double)_total_unchanged[top] / (double)_total_processed[top]);
+  }
+}
+
 void PhaseIterGVN::trace_PhaseIterGVN(Node* n, Node* nn, const Type* oldtype) {
   const Type* newtype = type_or_null(n);
   if (nn != n || oldtype != newtype) {
@@ -1042,9 +1087,11 @@ void PhaseIterGVN::optimize() {
     DEBUG_ONLY(trace_PhaseIterGVN_verbose(n, num_processed++);)
     if (n->outcnt() != 0) {
       NOT_PRODUCT(const Type* oldtype = type_or_null(n));
+      NOT_PRODUCT(int opcode = n->Opcode());
       // Do the transformation
       Node* nn = transform_old(n);
       NOT_PRODUCT(trace_PhaseIterGVN(n, nn, oldtype);)
+      NOT_PRODUCT(if (PrintOptoStatistics) record_processed(opcode, nn != n || oldtype != type_or_null(n));)
     } else if (!n->is_top()) {
       remove_dead_node(n);
     }
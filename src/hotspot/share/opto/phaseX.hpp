@@ -30,6 +30,7 @@
 #include "memory/resourceArea.hpp"
 #include "opto/memnode.hpp"
 #include "opto/node.hpp"
+#include "opto/opcodes.hpp"
 #include "opto/phase.hpp"
 #include "opto/type.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -501,6 +502,13 @@ class PhaseIterGVN : public PhaseGVN {
   void trace_PhaseIterGVN(Node* n, Node* nn, const Type* old_type);
   void init_verifyPhaseIterGVN();
   void verify_PhaseIterGVN();
+
+  // Per-opcode counts of worklist pops, and of pops that neither replaced
+  // the node nor changed its type. Collected with -XX:+PrintOptoStatistics.
+  static uint _total_processed[_last_opcode];
+  static uint _total_unchanged[_last_opcode];
+  static void record_processed(int opcode, bool progress);
+  static void print_statistics();
 #endif
 
 #ifdef ASSERT
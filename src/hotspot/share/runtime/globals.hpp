@@ -924,6 +924,12 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, UseDynamicNumberOfCompilerThreads, true,                    \
           "Dynamically choose the number of parallel compiler threads")     \
                                                                             \
+  product(uint, DynamicCompilerThreadsCPUPercent, 0, EXPERIMENTAL,          \
+          "Cap the number of compiler threads added dynamically to this "   \
+          "percentage of the active processor count, which includes the "   \
+          "container CPU quota. 0 means no cap")                            \
+          range(0, 100)                                                     \
+                                                                            \
   product(bool, ReduceNumberOfCompilerThreads, true, DIAGNOSTIC,            \
              "Reduce the number of parallel compiler threads when they "    \
              "are not used")                                                \
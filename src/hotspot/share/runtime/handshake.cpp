@@ -263,11 +263,14 @@ class VM_HandshakeAllThreads: public VM_Operation {
     _op->add_target_count(number_of_threads_issued - 1);
 
     log_trace(handshake)("Threads signaled, begin processing blocked threads by VMThread");
+    jlong signaled_time_ns = os::javaTimeNanos();
     HandshakeSpinYield hsy(start_time_ns);
     // Keeps count on how many of own emitted handshakes
     // this thread execute.
     int emitted_handshakes_executed = 0;
+    int passes = 0;
     do {
+      passes++;
       // Check if handshake operation has timed out
       check_handshake_timeout(start_time_ns, _op);
 
@@ -293,6 +296,9 @@ class VM_HandshakeAllThreads: public VM_Operation {
     // by the Handshakee.
     OrderAccess::acquire();
 
+    log_debug(handshake)("Handshake \"%s\" phases, Signal: " JLONG_FORMAT " ns, Process: " JLONG_FORMAT " ns, Passes: %d",
+                         _op->name(), signaled_time_ns - start_time_ns,
+                         os::javaTimeNanos() - signaled_time_ns, passes);
     log_handshake_info(start_time_ns, _op->name(), number_of_threads_issued, emitted_handshakes_executed);
   }
 
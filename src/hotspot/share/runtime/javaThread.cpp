@@ -429,6 +429,7 @@ JavaThread::JavaThread(MEMFLAGS flags) :
   _current_waiting_monitor(nullptr),
   _active_handles(nullptr),
   _free_handle_block(nullptr),
+  _global_handle_cache(nullptr),
 
   _suspend_flags(0),
 
@@ -672,6 +673,9 @@ JavaThread::~JavaThread() {
     delete old_array;
   }
 
+  // Normally already released by exit().
+  JNIHandles::release_global_handle_cache(this);
+
   JvmtiDeferredUpdates* updates = deferred_updates();
   if (updates != nullptr) {
     // This can only happen if thread is destroyed before deoptimization occurs.
@@ -947,6 +951,10 @@ void JavaThread::exit(bool destroy_vm, ExitType exit_type) {
     JNIHandleBlock::release_block(block);
   }
 
+  // Release the unused preallocated global handle entries before leaving
+  // the threads list, see JNIHandles::global_handle_count().
+  JNIHandles::release_global_handle_cache(this);
+
   // These have to be removed while this is still a valid thread.
   _stack_overflow_state.remove_stack_guard_pages();
 
@@ -1021,6 +1029,10 @@ void JavaThread::cleanup_failed_attach_current_thread(bool is_daemon) {
     JNIHandleBlock::release_block(block);
   }
 
+  // Release the unused preallocated global handle entries before leaving
+  // the threads list, see JNIHandles::global_handle_count().
+  JNIHandles::release_global_handle_cache(this);
+
   // These have to be removed while this is still a valid thread.
   _stack_overflow_state.remove_stack_guard_pages();
 
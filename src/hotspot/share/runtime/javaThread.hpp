@@ -53,6 +53,7 @@ class AsyncExceptionHandshake;
 class ContinuationEntry;
 class DeoptResourceMark;
 class InternalOOMEMark;
+class JNIGlobalHandleCache;
 class JNIHandleBlock;
 class JVMCIRuntime;
 
@@ -158,6 +159,9 @@ class JavaThread: public Thread {
   // One-element thread local free list
   JNIHandleBlock* _free_handle_block;
 
+  // Preallocated JNI global handle entries
+  JNIGlobalHandleCache* _global_handle_cache;
+
  public:
   // For tracking the heavyweight monitor the thread is pending on.
   ObjectMonitor* current_pending_monitor() {
@@ -188,6 +192,8 @@ class JavaThread: public Thread {
   void set_active_handles(JNIHandleBlock* block) { _active_handles = block; }
   JNIHandleBlock* free_handle_block() const      { return _free_handle_block; }
   void set_free_handle_block(JNIHandleBlock* block) { _free_handle_block = block; }
+  JNIGlobalHandleCache* global_handle_cache() const { return _global_handle_cache; }
+  void set_global_handle_cache(JNIGlobalHandleCache* cache) { _global_handle_cache = cache; }
 
   void push_jni_handle_block();
   void pop_jni_handle_block();
@@ -35,6 +35,7 @@
 #include "runtime/javaThread.inline.hpp"
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/threadSMR.hpp"
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 
@@ -82,6 +83,78 @@ static void report_handle_allocation_failure(AllocFailType alloc_failmode,
   }
 }
 
+// Thread local cache of entries preallocated from the JNI global handle
+// storage. The cache is refilled with one bulk allocation, so that most
+// make_global calls do not take the storage's allocation mutex. The cached
+// entries are allocated in the storage but hold null, so they are excluded
+// from global_handle_count() and rejected by handle_type().
+class JNIGlobalHandleCache : public CHeapObj<mtInternal> {
+  static const size_t capacity = 16;
+  STATIC_ASSERT(capacity <= OopStorage::bulk_allocate_limit);
+
+  OopStorage* const _storage;
+  size_t _count;
+  oop* _entries[capacity];
+
+public:
+  JNIGlobalHandleCache(OopStorage* storage) : _storage(storage), _count(0) {}
+
+  ~JNIGlobalHandleCache() {
+    if (_count > 0) {
+      _storage->release(_entries, _count);
+    }
+  }
+
+  size_t count() const { return _count; }
+
+  // Returns a free entry, or null if the storage could not allocate one.
+  oop* allocate() {
+    if (_count == 0) {
+      _count = _storage->allocate(_entries, capacity);
+      if (_count == 0) {
+        return nullptr;
+      }
+    }
+    return _entries[--_count];
+  }
+};
+
+oop* JNIHandles::allocate_global_entry() {
+  Thread* thread = Thread::current();
+  if (!thread->is_Java_thread()) {
+    return global_handles()->allocate();
+  }
+  JavaThread* jt = JavaThread::cast(thread);
+  JNIGlobalHandleCache* cache = jt->global_handle_cache();
+  if (cache == nullptr) {
+    cache = new JNIGlobalHandleCache(global_handles());
+    jt->set_global_handle_cache(cache);
+  }
+  return cache->allocate();
+}
+
+void JNIHandles::release_global_handle_cache(JavaThread* thread) {
+  JNIGlobalHandleCache* cache = thread->global_handle_cache();
+  if (cache != nullptr) {
+    thread->set_global_handle_cache(nullptr);
+    delete cache;
+  }
+}
+
+size_t JNIHandles::global_handle_count() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  // Threads release their cache before leaving the threads list, so all
+  // cached entries belong to threads on the list.
+  size_t cached = 0;
+  for (JavaThreadIteratorWithHandle jtiwh; JavaThread* t = jtiwh.next(); ) {
+    JNIGlobalHandleCache* cache = t->global_handle_cache();
+    if (cache != nullptr) {
+      cached += cache->count();
+    }
+  }
+  return global_handles()->allocation_count() - cached;
+}
+
 jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   assert(!Universe::heap()->is_stw_gc_active(), "can't extend the root set during GC pause");
   assert(!current_thread_in_native(), "must not be in native");
@@ -89,7 +162,7 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    oop* ptr = allocate_global_entry();
     // Return null on allocation failure.
     if (ptr != nullptr) {
       assert(NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) == oop(nullptr), "invariant");
@@ -179,6 +252,12 @@ inline bool is_storage_handle(const OopStorage* storage, const oop* ptr) {
   return storage->allocation_status(ptr) == OopStorage::ALLOCATED_ENTRY;
 }
 
+// A global handle that has been handed out never holds null, unlike the
+// allocated but unused entries in the per-thread global handle caches.
+static bool is_live_global_entry(oop* ptr) {
+  return NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) != nullptr;
+}
+
 
 jobjectRefType JNIHandles::handle_type(JavaThread* thread, jobject handle) {
   assert(handle != nullptr, "precondition");
@@ -190,7 +269,9 @@ jobjectRefType JNIHandles::handle_type(JavaThread* thread, jobject handle) {
   } else if (is_global_tagged(handle)) {
     switch (global_handles()->allocation_status(global_ptr(handle))) {
     case OopStorage::ALLOCATED_ENTRY:
-      result = JNIGlobalRefType;
+      if (is_live_global_entry(global_ptr(handle))) {
+        result = JNIGlobalRefType;
+      }
       break;
 
     case OopStorage::UNALLOCATED_ENTRY:
@@ -238,7 +319,9 @@ bool JNIHandles::is_frame_handle(JavaThread* thr, jobject handle) {
 
 bool JNIHandles::is_global_handle(jobject handle) {
   assert(handle != nullptr, "precondition");
-  return is_global_tagged(handle) && is_storage_handle(global_handles(), global_ptr(handle));
+  return is_global_tagged(handle) &&
+         is_storage_handle(global_handles(), global_ptr(handle)) &&
+         is_live_global_entry(global_ptr(handle));
 }
 
 
@@ -252,7 +335,7 @@ void JNIHandles::print_on(outputStream* st) {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
 
   st->print_cr("JNI global refs: " SIZE_FORMAT ", weak refs: " SIZE_FORMAT,
-               global_handles()->allocation_count(),
+               global_handle_count(),
                weak_global_handles()->allocation_count());
   st->cr();
   st->flush();
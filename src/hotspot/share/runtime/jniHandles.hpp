@@ -61,6 +61,10 @@ class JNIHandles : AllStatic {
   // this header file and thread.hpp.
   static bool current_thread_in_native();
 
+  // Allocates an entry from the global storage, using the current thread's
+  // global handle cache when it is a JavaThread.
+  static oop* allocate_global_entry();
+
  public:
   // Low tag bits in jobject used to distinguish its type. Checking
   // the underlying storage type is unsuitable for performance reasons.
@@ -101,6 +105,11 @@ class JNIHandles : AllStatic {
   static jobject make_global(Handle  obj,
                              AllocFailType alloc_failmode = AllocFailStrategy::EXIT_OOM);
   static void destroy_global(jobject handle);
+  // Number of global handles in use. Entries preallocated in the per-thread
+  // caches are not counted. Must be called at a safepoint.
+  static size_t global_handle_count();
+  // Releases the entries still held in the thread's global handle cache.
+  static void release_global_handle_cache(JavaThread* thread);
 
   // Weak global handles
   static jweak make_weak_global(Handle obj,
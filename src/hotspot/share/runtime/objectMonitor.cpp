@@ -1906,6 +1906,15 @@ bool ObjectMonitor::short_fixed_spin(JavaThread* current, int spin_count, bool a
 
 // Spinning: Fixed frequency (100%), vary duration
 bool ObjectMonitor::TrySpin(JavaThread* current) {
+  if (try_spin_impl(current)) {
+    OM_PERFDATA_OP(SpinSuccesses, inc());
+    return true;
+  }
+  OM_PERFDATA_OP(SpinFailures, inc());
+  return false;
+}
+
+bool ObjectMonitor::try_spin_impl(JavaThread* current) {
 
   // Dumb, brutal spin.  Good for comparative measurements against adaptive spinning.
   int knob_fixed_spin = Knob_FixedSpin;  // 0 (don't spin: default), 2000 good test
@@ -2124,6 +2133,8 @@ inline void ObjectMonitor::DequeueSpecificWaiter(ObjectWaiter* node) {
 PerfCounter * ObjectMonitor::_sync_ContendedLockAttempts       = nullptr;
 PerfCounter * ObjectMonitor::_sync_FutileWakeups               = nullptr;
 PerfCounter * ObjectMonitor::_sync_Parks                       = nullptr;
+PerfCounter * ObjectMonitor::_sync_SpinSuccesses               = nullptr;
+PerfCounter * ObjectMonitor::_sync_SpinFailures                = nullptr;
 PerfCounter * ObjectMonitor::_sync_Notifications               = nullptr;
 PerfCounter * ObjectMonitor::_sync_Inflations                  = nullptr;
 PerfCounter * ObjectMonitor::_sync_Deflations                  = nullptr;
@@ -2161,6 +2172,8 @@ void ObjectMonitor::Initialize() {
     NEWPERFCOUNTER(_sync_ContendedLockAttempts);
     NEWPERFCOUNTER(_sync_FutileWakeups);
     NEWPERFCOUNTER(_sync_Parks);
+    NEWPERFCOUNTER(_sync_SpinSuccesses);
+    NEWPERFCOUNTER(_sync_SpinFailures);
     NEWPERFCOUNTER(_sync_Notifications);
     NEWPERFVARIABLE(_sync_MonExtant);
 #undef NEWPERFCOUNTER
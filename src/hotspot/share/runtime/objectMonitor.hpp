@@ -206,6 +206,8 @@ class ObjectMonitor : public CHeapObj<mtObjectMonitor> {
   static PerfCounter * _sync_ContendedLockAttempts;
   static PerfCounter * _sync_FutileWakeups;
   static PerfCounter * _sync_Parks;
+  static PerfCounter * _sync_SpinSuccesses;
+  static PerfCounter * _sync_SpinFailures;
   static PerfCounter * _sync_Notifications;
   static PerfCounter * _sync_Inflations;
   static PerfCounter * _sync_Deflations;
@@ -360,6 +362,7 @@ class ObjectMonitor : public CHeapObj<mtObjectMonitor> {
   TryLockResult  TryLock(JavaThread* current);
 
   bool      TrySpin(JavaThread* current);
+  bool      try_spin_impl(JavaThread* current);
   bool      short_fixed_spin(JavaThread* current, int spin_count, bool adapt);
   void      ExitEpilog(JavaThread* current, ObjectWaiter* Wakee);
 
@@ -66,6 +66,7 @@
 #include "services/runtimeService.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/powerOfTwo.hpp"
 #include "utilities/systemMemoryBarrier.hpp"
 
 static void post_safepoint_begin_event(EventSafepointBegin& event,
@@ -195,6 +196,34 @@ static void back_off(int64_t start_time) {
   }
 }
 
+// Log the thread that reached the safepoint last, and where it was when it
+// stopped. A thread blocked in a safepoint poll has its last Java pc at the
+// poll, which points at the loop or call that delayed the safepoint.
+static void log_last_straggler(JavaThread* thread, int64_t wait_ns) {
+  LogTarget(Debug, safepoint) lt;
+  if (!lt.is_enabled()) {
+    return;
+  }
+  ResourceMark rm;
+  LogStream ls(lt);
+  ls.print("Last thread to reach safepoint after " INT64_FORMAT " ns: %s",
+           wait_ns, thread->name());
+  if (thread->has_last_Java_frame()) {
+    // The anchor of a thread stopped in the safepoint handler blob has no
+    // pc on some platforms; last_frame() recovers it from the stack. This
+    // is safe as the thread is safepoint-safe and the threads list is held.
+    address pc = thread->last_frame().pc();
+    ls.print(" pc " INTPTR_FORMAT, p2i(pc));
+    CodeBlob* cb = CodeCache::find_blob(pc);
+    if (cb != nullptr && cb->is_nmethod()) {
+      ls.print(" in %s", cb->as_nmethod()->method()->external_name());
+    } else if (cb != nullptr) {
+      ls.print(" in %s", cb->name());
+    }
+  }
+  ls.cr();
+}
+
 int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running)
 {
   JavaThreadIteratorWithHandle jtiwh;
@@ -234,6 +263,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
 
   int iterations = 1; // The first iteration is above.
   int64_t start_time = os::javaTimeNanos();
+  JavaThread* last_straggler = nullptr;
 
   do {
     // Check if this has taken too long:
@@ -247,6 +277,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
         --still_running;
+        last_straggler = cur_tss->thread();
         *p_prev = nullptr;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -269,6 +300,10 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
 
   assert(tss_head == nullptr, "Must be empty");
 
+  // All threads are safepoint-safe and the threads list is still held, so
+  // the straggler cannot exit or move its frame anchor while we look at it.
+  log_last_straggler(last_straggler, os::javaTimeNanos() - start_time);
+
   return iterations;
 }
 
@@ -870,6 +905,8 @@ VM_Operation::VMOp_Type SafepointTracing::_current_type;
 jlong     SafepointTracing::_max_sync_time = 0;
 jlong     SafepointTracing::_max_vmop_time = 0;
 uint64_t  SafepointTracing::_op_count[VM_Operation::VMOp_Terminating] = {0};
+uint64_t  SafepointTracing::_sync_time_histogram[SafepointTracing::histogram_buckets] = {0};
+uint64_t  SafepointTracing::_vmop_time_histogram[SafepointTracing::histogram_buckets] = {0};
 
 void SafepointTracing::init() {
   // Application start
@@ -920,6 +957,29 @@ void SafepointTracing::statistics_log() {
   ls.print_cr(INT32_FORMAT_W(16), _page_trap);
 }
 
+void SafepointTracing::record_in_histogram(uint64_t* histogram, jlong time_ns) {
+  jlong time_us = time_ns / (NANOUNITS / MICROUNITS);
+  int bucket = (time_us <= 0) ? 0 : log2i(time_us) + 1;
+  histogram[MIN2(bucket, histogram_buckets - 1)]++;
+}
+
+void SafepointTracing::print_histogram(const char* name, const uint64_t* histogram) {
+  log_info(safepoint, stats)("%s histogram (us):", name);
+  for (int i = 0; i < histogram_buckets; i++) {
+    if (histogram[i] == 0) {
+      continue;
+    }
+    jlong low = histogram_bucket_low_us(i);
+    if (i == histogram_buckets - 1) {
+      log_info(safepoint, stats)("  " JLONG_FORMAT_W(8) " -          " UINT64_FORMAT_W(10),
+                                 low, histogram[i]);
+    } else {
+      log_info(safepoint, stats)("  " JLONG_FORMAT_W(8) " - " JLONG_FORMAT_W(8) " " UINT64_FORMAT_W(10),
+                                 low, histogram_bucket_low_us(i + 1), histogram[i]);
+    }
+  }
+}
+
 // This method will be called when VM exits. This tries to summarize the sampling.
 // Current thread may already be deleted, so don't use ResourceMark.
 void SafepointTracing::statistics_exit_log() {
@@ -938,6 +998,8 @@ void SafepointTracing::statistics_exit_log() {
   log_info(safepoint, stats)("Maximum vm operation time (except for Exit VM operation)  "
                               INT64_FORMAT " ns",
                               (int64_t)(_max_vmop_time));
+  print_histogram("Sync time", _sync_time_histogram);
+  print_histogram("Vm operation time", _vmop_time_histogram);
 }
 
 void SafepointTracing::begin(VM_Operation::VMOp_Type type) {
@@ -971,6 +1033,8 @@ void SafepointTracing::end() {
   if (_max_vmop_time < (_last_safepoint_end_time_ns - _last_safepoint_sync_time_ns)) {
     _max_vmop_time = _last_safepoint_end_time_ns - _last_safepoint_sync_time_ns;
   }
+  record_in_histogram(_sync_time_histogram, _last_safepoint_sync_time_ns - _last_safepoint_begin_time_ns);
+  record_in_histogram(_vmop_time_histogram, _last_safepoint_end_time_ns - _last_safepoint_sync_time_ns);
   if (log_is_enabled(Info, safepoint, stats)) {
     statistics_log();
   }
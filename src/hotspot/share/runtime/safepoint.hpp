@@ -244,7 +244,16 @@ class SafepointTracing : public AllStatic {
   static jlong     _max_vmop_time;
   static uint64_t  _op_count[VM_Operation::VMOp_Terminating];
 
+  // Log2 histograms of the sync and vm operation times, in microseconds.
+  // Bucket 0 counts times below 1 us, bucket i > 0 times in [2^(i-1), 2^i) us,
+  // and the last bucket everything above.
+  static const int histogram_buckets = 24;
+  static uint64_t  _sync_time_histogram[histogram_buckets];
+  static uint64_t  _vmop_time_histogram[histogram_buckets];
+
   static void statistics_log();
+  static void record_in_histogram(uint64_t* histogram, jlong time_ns);
+  static void print_histogram(const char* name, const uint64_t* histogram);
 
 public:
   static void init();
@@ -255,6 +264,14 @@ class SafepointTracing : public AllStatic {
 
   static void statistics_exit_log();
 
+  // Access to the sync and vm operation time histograms.
+  static int histogram_bucket_count() { return histogram_buckets; }
+  static jlong histogram_bucket_low_us(int bucket) {
+    return (bucket == 0) ? 0 : (jlong)1 << (bucket - 1);
+  }
+  static uint64_t sync_time_count(int bucket) { return _sync_time_histogram[bucket]; }
+  static uint64_t vmop_time_count(int bucket) { return _vmop_time_histogram[bucket]; }
+
   static jlong time_since_last_safepoint_ms() {
     return nanos_to_millis(os::javaTimeNanos() - _last_safepoint_end_time_ns);
   }
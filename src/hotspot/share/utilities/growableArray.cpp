@@ -35,6 +35,10 @@ void* GrowableArrayResourceAllocator::allocate(int max, int elementSize) {
   return (void*)resource_allocate_bytes(byte_size);
 }
 
+bool GrowableArrayResourceAllocator::expand_in_place(void* elements, size_t old_size, size_t new_size) {
+  return Thread::current()->resource_area()->Agrow_in_place(elements, old_size, new_size);
+}
+
 void* GrowableArrayArenaAllocator::allocate(int max, int element_size, Arena* arena) {
   assert(max >= 0, "integer overflow");
   size_t byte_size = element_size * (size_t) max;
@@ -42,6 +46,10 @@ void* GrowableArrayArenaAllocator::allocate(int max, int element_size, Arena* ar
   return arena->Amalloc(byte_size);
 }
 
+bool GrowableArrayArenaAllocator::expand_in_place(void* elements, size_t old_size, size_t new_size, Arena* arena) {
+  return arena->Agrow_in_place(elements, old_size, new_size);
+}
+
 void* GrowableArrayCHeapAllocator::allocate(int max, int element_size, MEMFLAGS memflags) {
   assert(max >= 0, "integer overflow");
   size_t byte_size = element_size * (size_t) max;
@@ -379,6 +379,9 @@ class GrowableArrayFromArray : public GrowableArrayView<E> {
 // Derived: The sub-class responsible for allocation / deallocation
 //  - E* Derived::allocate()       - member function responsible for allocation
 //  - void Derived::deallocate(E*) - member function responsible for deallocation
+//  - bool Derived::expand_in_place(int old_capacity)
+//                                 - member function that tries to grow the
+//                                   data array to _capacity without moving it
 template <typename E, typename Derived>
 class GrowableArrayWithAllocator : public GrowableArrayView<E> {
   friend class VMStructs;
@@ -523,6 +526,10 @@ void GrowableArrayWithAllocator<E, Derived>::expand_to(int new_capacity) {
   assert(new_capacity > old_capacity,
          "expected growth but %d <= %d", new_capacity, old_capacity);
   this->_capacity = new_capacity;
+  if (this->_data != nullptr && static_cast<Derived*>(this)->expand_in_place(old_capacity)) {
+    for (int i = old_capacity; i < this->_capacity; i++) ::new ((void*)&this->_data[i]) E();
+    return;
+  }
   E* newData = static_cast<Derived*>(this)->allocate();
   int i = 0;
   for (     ; i < this->_len; i++) ::new ((void*)&newData[i]) E(this->_data[i]);
@@ -584,12 +591,14 @@ void GrowableArrayWithAllocator<E, Derived>::clear_and_deallocate() {
 class GrowableArrayResourceAllocator {
 public:
   static void* allocate(int max, int element_size);
+  static bool expand_in_place(void* elements, size_t old_size, size_t new_size);
 };
 
 // Arena allocator
 class GrowableArrayArenaAllocator {
 public:
   static void* allocate(int max, int element_size, Arena* arena);
+  static bool expand_in_place(void* elements, size_t old_size, size_t new_size, Arena* arena);
 };
 
 // CHeap allocator
@@ -749,6 +758,23 @@ class GrowableArray : public GrowableArrayWithAllocator<E, GrowableArray<E>> {
     }
   }
 
+  // Arena and resource area data that is still the most recent allocation
+  // in its arena is grown without copying.
+  bool expand_in_place(int old_capacity) {
+    size_t old_size = sizeof(E) * (size_t) old_capacity;
+    size_t new_size = sizeof(E) * (size_t) this->_capacity;
+    if (on_resource_area()) {
+      debug_only(_metadata.on_resource_area_alloc_check());
+      return GrowableArrayResourceAllocator::expand_in_place(this->_data, old_size, new_size);
+    }
+
+    if (on_arena()) {
+      return GrowableArrayArenaAllocator::expand_in_place(this->_data, old_size, new_size, _metadata.arena());
+    }
+
+    return false;
+  }
+
 public:
   GrowableArray() : GrowableArray(2 /* initial_capacity */) {}
 
@@ -824,6 +850,10 @@ class GrowableArrayCHeap : public GrowableArrayWithAllocator<E, GrowableArrayCHe
     GrowableArrayCHeapAllocator::deallocate(mem);
   }
 
+  bool expand_in_place(int old_capacity) {
+    return false;
+  }
+
 public:
   GrowableArrayCHeap(int initial_capacity = 0) :
       GrowableArrayWithAllocator<E, GrowableArrayCHeap<E, F> >(
@@ -78,6 +78,7 @@ class G1CardSetTest : public ::testing::Test {
 
   static void cardset_basic_test();
   static void cardset_mt_test();
+  static void cardset_fingerprint_test();
 
   static void add_cards(G1CardSet* card_set, uint cards_per_region, uint* cards, uint num_cards, G1AddCardResult* results);
   static void contains_cards(G1CardSet* card_set, uint cards_per_region, uint* cards, uint num_cards);
@@ -479,6 +480,61 @@ void G1CardSetTest::cardset_mt_test() {
   ASSERT_TRUE(count_cards._num_cards <= cl.added());
 }
 
+class G1CollectFingerprintsClosure : public G1CardSet::ContainerFingerprintClosure {
+public:
+  static const uint MaxRegions = 8;
+  uint64_t _hash[MaxRegions];
+  size_t _num_containers;
+
+  G1CollectFingerprintsClosure() : _num_containers(0) {
+    for (uint i = 0; i < MaxRegions; i++) {
+      _hash[i] = 0;
+    }
+  }
+
+  void do_fingerprint(uint card_region_idx,
+                      uint container_type,
+                      size_t num_occupied,
+                      uint64_t hash,
+                      size_t container_mem_size) override {
+    ASSERT_LT(card_region_idx, MaxRegions);
+    ASSERT_GT(container_mem_size, (size_t)0);
+    _hash[card_region_idx] = hash;
+    _num_containers++;
+  }
+};
+
+void G1CardSetTest::cardset_fingerprint_test() {
+  const uint CardsPerRegion = 2048;
+  const uint NumCards = 10;
+
+  G1CardSetConfiguration config(28, 0.9, 8, 0.8, CardsPerRegion, 0);
+  G1CardSetFreePool free_pool(config.num_mem_object_types());
+  G1CardSetMemoryManager mm(&config, &free_pool);
+
+  G1CardSet card_set1(&config, &mm);
+  G1CardSet card_set2(&config, &mm);
+
+  // Same cards in region 5 added in different order, shifted cards in region 6,
+  // and a single (inline) card in region 7.
+  for (uint i = 0; i < NumCards; i++) {
+    card_set1.add_card(5, 10 + i);
+    card_set2.add_card(5, 10 + NumCards - 1 - i);
+    card_set2.add_card(6, 11 + i);
+  }
+  card_set2.add_card(7, 1);
+
+  G1CollectFingerprintsClosure cl1;
+  card_set1.iterate_container_fingerprints(&cl1);
+  G1CollectFingerprintsClosure cl2;
+  card_set2.iterate_container_fingerprints(&cl2);
+
+  ASSERT_EQ(cl1._num_containers, (size_t)1);
+  ASSERT_EQ(cl2._num_containers, (size_t)2);
+  ASSERT_EQ(cl1._hash[5], cl2._hash[5]);
+  ASSERT_NE(cl2._hash[5], cl2._hash[6]);
+}
+
 TEST_VM(G1CardSetTest, basic_cardset_test) {
   G1CardSetTest::cardset_basic_test();
 }
@@ -486,3 +542,7 @@ TEST_VM(G1CardSetTest, basic_cardset_test) {
 TEST_VM(G1CardSetTest, mt_cardset_test) {
   G1CardSetTest::cardset_mt_test();
 }
+
+TEST_VM(G1CardSetTest, fingerprint_cardset_test) {
+  G1CardSetTest::cardset_fingerprint_test();
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CopyCostModel.hpp"
+#include "unittest.hpp"
+
+TEST_VM(G1CopyCostModel, no_estimate_initially) {
+  G1CopyCostModel m;
+  ASSERT_FALSE(m.has_estimate());
+  ASSERT_EQ(m.cost_ratio(G1CopyCostModel::Eden), 1.0);
+  ASSERT_EQ(m.cost_ratio(G1CopyCostModel::Survivor), 1.0);
+}
+
+TEST_VM(G1CopyCostModel, no_estimate_for_constant_mix) {
+  G1CopyCostModel m;
+  for (uint i = 0; i < 20; i++) {
+    // Always the same ratio of eden to survivor bytes.
+    size_t const scale = i + 1;
+    m.add_sample(10 * M * scale, 5 * M * scale, 20.0 * scale);
+  }
+  ASSERT_FALSE(m.has_estimate());
+  ASSERT_EQ(m.cost_ratio(G1CopyCostModel::Eden), 1.0);
+  ASSERT_EQ(m.cost_ratio(G1CopyCostModel::Survivor), 1.0);
+}
+
+TEST_VM(G1CopyCostModel, separates_cohort_costs) {
+  G1CopyCostModel m;
+  double const eden_cost_per_mb = 1.0;
+  double const survivor_cost_per_mb = 3.0;
+  for (uint i = 0; i < 20; i++) {
+    size_t const eden_mb = 10 + (i % 4) * 5;
+    size_t const survivor_mb = 2 + (i % 3) * 4;
+    m.add_sample(eden_mb * M, survivor_mb * M,
+                 eden_mb * eden_cost_per_mb + survivor_mb * survivor_cost_per_mb);
+  }
+  ASSERT_TRUE(m.has_estimate());
+  double const eden_ratio = m.cost_ratio(G1CopyCostModel::Eden);
+  double const survivor_ratio = m.cost_ratio(G1CopyCostModel::Survivor);
+  ASSERT_LT(eden_ratio, 1.0);
+  ASSERT_GT(survivor_ratio, 1.0);
+  ASSERT_NEAR(survivor_ratio / eden_ratio, survivor_cost_per_mb / eden_cost_per_mb, 1e-6);
+}
+
+TEST_VM(G1CopyCostModel, ignores_empty_samples) {
+  G1CopyCostModel m;
+  for (uint i = 0; i < 20; i++) {
+    m.add_sample(0, 0, 1.0);
+    m.add_sample(M, M, 0.0);
+  }
+  ASSERT_FALSE(m.has_estimate());
+}
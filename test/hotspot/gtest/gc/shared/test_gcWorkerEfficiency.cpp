@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "gc/shared/gcWorkerEfficiency.hpp"
+#include "runtime/flags/flagSetting.hpp"
+#include "runtime/os.hpp"
+#include "unittest.hpp"
+
+static const uint NumWorkers = 16;
+
+TEST_VM(GCWorkerEfficiency, disabled) {
+  UIntFlagSetting fs(GCWorkerEfficiencyTargetPercent, 0);
+  GCWorkerEfficiency efficiency;
+  ASSERT_EQ(NumWorkers, efficiency.limit_active_workers(NumWorkers));
+}
+
+TEST_VM(GCWorkerEfficiency, shrink_and_grow) {
+  if (!os::is_thread_cpu_time_supported()) {
+    return;
+  }
+  UIntFlagSetting fs(GCWorkerEfficiencyTargetPercent, 80);
+  GCWorkerEfficiency efficiency;
+  ASSERT_EQ(NumWorkers, efficiency.limit_active_workers(NumWorkers));
+
+  // Workers busy only a quarter of the task time shrink the limit, but by at
+  // most half at a time.
+  uint workers = NumWorkers;
+  for (int i = 0; i < 10; ++i) {
+    efficiency.record(workers, (jlong)(0.25 * NANOUNITS * workers), (jlong)NANOUNITS * workers);
+    uint limited = efficiency.limit_active_workers(NumWorkers);
+    ASSERT_LE(limited, workers);
+    ASSERT_GE(limited, workers / 2);
+    ASSERT_GE(limited, 1u);
+    workers = limited;
+  }
+  ASSERT_LT(workers, NumWorkers);
+
+  // Fully busy workers raise the limit again, one worker at a time.
+  for (int i = 0; i < 100; ++i) {
+    efficiency.record(workers, (jlong)NANOUNITS * workers, (jlong)NANOUNITS * workers);
+    uint limited = efficiency.limit_active_workers(NumWorkers);
+    ASSERT_LE(limited, workers + 1);
+    workers = limited;
+  }
+  ASSERT_EQ(NumWorkers, workers);
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "unittest.hpp"
+
+typedef StealableOverflowTaskQueue<uintptr_t, mtGC, 1024> TestQueue;
+typedef StealableOverflowTaskQueueSet<TestQueue, mtGC>     TestQueueSet;
+
+static const uint NumElements = 1024 + 4 * TestQueue::ChunkSize + 17;
+
+static uint drain(TestQueue* q, bool* seen) {
+  uint count = 0;
+  uintptr_t t;
+  for (;;) {
+    if (q->pop_overflow(t) || q->pop_local(t)) {
+      EXPECT_LT(t, NumElements);
+      EXPECT_FALSE(seen[t]);
+      seen[t] = true;
+      count++;
+    } else if (q->is_empty()) {
+      return count;
+    }
+  }
+}
+
+TEST_VM(StealableOverflowTaskQueue, push_pop) {
+  TestQueue* q = new TestQueue();
+
+  for (uintptr_t i = 0; i < NumElements; i++) {
+    q->push(i);
+  }
+  ASSERT_FALSE(q->overflow_empty());
+  ASSERT_EQ(4 * TestQueue::ChunkSize, q->published_size());
+
+  bool* seen = NEW_C_HEAP_ARRAY(bool, NumElements, mtGC);
+  memset(seen, 0, NumElements * sizeof(bool));
+  ASSERT_EQ(NumElements, drain(q, seen));
+  ASSERT_TRUE(q->is_empty());
+
+  FREE_C_HEAP_ARRAY(bool, seen);
+  delete q;
+}
+
+TEST_VM(StealableOverflowTaskQueue, steal_chunk) {
+  TestQueue* owner = new TestQueue();
+  TestQueue* thief = new TestQueue();
+
+  TestQueueSet* set = new TestQueueSet(2);
+  set->register_queue(0, owner);
+  set->register_queue(1, thief);
+
+  for (uintptr_t i = 0; i < NumElements; i++) {
+    owner->push(i);
+  }
+
+  bool* seen = NEW_C_HEAP_ARRAY(bool, NumElements, mtGC);
+  memset(seen, 0, NumElements * sizeof(bool));
+
+  // Empty the owner's TaskQueue, so that the thief can only get work from
+  // the published overflow chunks.
+  uintptr_t t;
+  uint count = 0;
+  while (owner->pop_local(t)) {
+    seen[t] = true;
+    count++;
+  }
+  const uint tasks_before = set->tasks();
+  ASSERT_EQ(4 * TestQueue::ChunkSize, tasks_before);
+
+  ASSERT_TRUE(set->steal(1, t));
+  seen[t] = true;
+  count++;
+  ASSERT_EQ(3 * TestQueue::ChunkSize, owner->published_size());
+  ASSERT_EQ(TestQueue::ChunkSize - 1, thief->size());
+
+  count += drain(thief, seen);
+  count += drain(owner, seen);
+  ASSERT_EQ(NumElements, count);
+  for (uint i = 0; i < NumElements; i++) {
+    ASSERT_TRUE(seen[i]) << "missing " << i;
+  }
+
+  FREE_C_HEAP_ARRAY(bool, seen);
+  delete set;
+  delete owner;
+  delete thief;
+}
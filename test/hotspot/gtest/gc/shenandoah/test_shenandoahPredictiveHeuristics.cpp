@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shenandoah/heuristics/shenandoahPredictiveHeuristics.hpp"
+
+#include "unittest.hpp"
+
+TEST(ShenandoahPhaseCostModelTest, no_samples_predicts_nothing) {
+  ShenandoahPhaseCostModel model;
+  EXPECT_FALSE(model.has_samples());
+  EXPECT_EQ(0.0, model.predict(1 * M, 1.0));
+}
+
+TEST(ShenandoahPhaseCostModelTest, scales_with_work) {
+  ShenandoahPhaseCostModel model;
+  for (int i = 0; i < 5; i++) {
+    model.record(0.010, 1 * M);
+  }
+  EXPECT_TRUE(model.has_samples());
+  EXPECT_NEAR(0.010, model.predict(1 * M, 0.0), 1e-9);
+  EXPECT_NEAR(0.040, model.predict(4 * M, 0.0), 1e-9);
+}
+
+TEST(ShenandoahPhaseCostModelTest, margin_makes_prediction_conservative) {
+  ShenandoahPhaseCostModel model;
+  model.record(0.010, 1 * M);
+  model.record(0.030, 1 * M);
+  model.record(0.010, 1 * M);
+  model.record(0.030, 1 * M);
+
+  double average = model.predict(1 * M, 0.0);
+  EXPECT_GT(model.predict(1 * M, 1.0), average);
+  EXPECT_GT(model.predict(1 * M, 2.0), model.predict(1 * M, 1.0));
+
+  // Negative margin does not go below the average
+  EXPECT_EQ(average, model.predict(1 * M, -1.0));
+}
@@ -214,6 +214,45 @@ TEST_VM(Arena, realloc_nontop_grow) {
   ASSERT_RANGE_IS_MARKED(p2, 10); // realloc should preserve old content
 }
 
+// in-place growing of the top allocation.
+TEST_VM(Arena, grow_in_place_top) {
+  Arena ar(mtTest);
+
+  void* p1 = ar.Amalloc(0x10);
+  ASSERT_AMALLOC(ar, p1);
+  GtestUtils::mark_range(p1, 0x10);
+
+  ASSERT_TRUE(ar.Agrow_in_place(p1, 0x10, 0x20));
+  ASSERT_EQ((char*)p1 + 0x20, ar.hwm());
+  ASSERT_RANGE_IS_MARKED(p1, 0x10);
+}
+
+// a non-top allocation cannot grow in place.
+TEST_VM(Arena, grow_in_place_nontop) {
+  Arena ar(mtTest);
+
+  void* p1 = ar.Amalloc(0x10);
+  ASSERT_AMALLOC(ar, p1);
+
+  void* p_other = ar.Amalloc(0x20); // new top, p1 not top anymore
+  char* hwm = ar.hwm();
+
+  ASSERT_FALSE(ar.Agrow_in_place(p1, 0x10, 0x20));
+  ASSERT_EQ(hwm, ar.hwm());
+}
+
+// growing beyond the current chunk fails and leaves the arena unchanged.
+TEST_VM(Arena, grow_in_place_beyond_chunk) {
+  Arena ar(mtTest);
+
+  void* p1 = ar.Amalloc(0x10);
+  ASSERT_AMALLOC(ar, p1);
+  char* hwm = ar.hwm();
+
+  ASSERT_FALSE(ar.Agrow_in_place(p1, 0x10, Chunk::size + 0x10));
+  ASSERT_EQ(hwm, ar.hwm());
+}
+
 // -------- random alloc test -------------
 
 static uint8_t canary(int i) {
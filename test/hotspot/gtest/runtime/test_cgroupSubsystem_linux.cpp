@@ -408,6 +408,33 @@ TEST(cgroupTest, read_numerical_key_beyond_max_path) {
   EXPECT_EQ((julong)0xBAD, a) << "Expected untouched scan value";
 }
 
+TEST(cgroupTest, memory_pressure_test) {
+  char* test_dir = temp_file("cgroups-psi");
+  ASSERT_EQ(0, mkdir(test_dir, 0700)) << "failed to create directory '" << test_dir << "'";
+  stringStream path;
+  path.print_raw(test_dir);
+  path.print_raw("/memory.pressure");
+  const char* pressure_file = path.as_string(true);
+
+  TestController* controller = new TestController(test_dir);
+  CgroupV2Subsystem subsystem(controller);
+
+  fill_file(pressure_file, "some avg10=12.34 avg60=5.00 avg300=1.00 total=123456\n"
+                           "full avg10=1.00 avg60=0.50 avg300=0.10 total=2345\n");
+  EXPECT_DOUBLE_EQ(12.34, subsystem.memory_pressure());
+
+  fill_file(pressure_file, "some avg10=0.00 avg60=0.00 avg300=0.00 total=0\n");
+  EXPECT_DOUBLE_EQ(0.0, subsystem.memory_pressure());
+
+  fill_file(pressure_file, "full avg10=1.00 avg60=0.50 avg300=0.10 total=2345\n");
+  EXPECT_DOUBLE_EQ((double)OSCONTAINER_ERROR, subsystem.memory_pressure()) << "Missing 'some' line should be an error";
+
+  delete_file(pressure_file);
+  EXPECT_DOUBLE_EQ((double)OSCONTAINER_ERROR, subsystem.memory_pressure()) << "Missing file should be an error";
+
+  rmdir(test_dir);
+}
+
 TEST(cgroupTest, read_numerical_key_file_not_exist) {
   TestController* unknown_path_ctrl = new TestController((char*)"/do/not/exist");
   const char* test_file_path = "/file-not-found";
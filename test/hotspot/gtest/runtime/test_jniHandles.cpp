@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/oopStorage.hpp"
+#include "gc/shared/oopStorageSet.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/javaThread.hpp"
+#include "runtime/jniHandles.hpp"
+#include "runtime/os.hpp"
+#include "utilities/enumIterator.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "threadHelper.inline.hpp"
+#include "unittest.hpp"
+
+static OopStorage* jni_global_storage() {
+  for (auto id : EnumRange<OopStorageSet::StrongId>()) {
+    OopStorage* storage = OopStorageSet::storage(id);
+    if (JNIHandles::is_global_storage(storage)) {
+      return storage;
+    }
+  }
+  return nullptr;
+}
+
+struct JNIGlobalHandleTestResult {
+  size_t _count_while_cached;
+  bool _all_global;
+
+  JNIGlobalHandleTestResult() : _count_while_cached(0), _all_global(true) {}
+};
+
+class JNIGlobalHandleTestThread : public JavaTestThread {
+  static const int NumHandles = 3;
+  // Owned by the test, this thread may be deleted as soon as it is joined.
+  JNIGlobalHandleTestResult* const _result;
+
+public:
+  JNIGlobalHandleTestThread(Semaphore* post, JNIGlobalHandleTestResult* result)
+    : JavaTestThread(post), _result(result) {}
+
+  void main_run() override {
+    Handle obj(this, threadObj());
+    jobject handles[NumHandles];
+    for (int i = 0; i < NumHandles; i++) {
+      handles[i] = JNIHandles::make_global(obj);
+      _result->_all_global = _result->_all_global && JNIHandles::is_global_handle(handles[i]);
+    }
+    for (int i = 0; i < NumHandles; i++) {
+      JNIHandles::destroy_global(handles[i]);
+    }
+    // The rest of the cache refill stays allocated in the storage.
+    _result->_count_while_cached = jni_global_storage()->allocation_count();
+  }
+};
+
+// Entries preallocated in the cache of a thread are released when it exits.
+TEST_VM(JNIHandles, global_handle_cache_released_at_thread_exit) {
+  OopStorage* storage = jni_global_storage();
+  ASSERT_NE(nullptr, storage);
+  const size_t count_before = storage->allocation_count();
+
+  Semaphore post;
+  JNIGlobalHandleTestResult result;
+  JNIGlobalHandleTestThread* t = new JNIGlobalHandleTestThread(&post, &result);
+  t->doit();
+  t->join();
+  EXPECT_TRUE(result._all_global);
+  EXPECT_GT(result._count_while_cached, count_before);
+
+  // The thread releases its cache on its way out, after signalling.
+  size_t count_after = storage->allocation_count();
+  for (int i = 0; i < 1000 && count_after != count_before; i++) {
+    os::naked_short_sleep(10);
+    count_after = storage->allocation_count();
+  }
+  EXPECT_EQ(count_before, count_after);
+}
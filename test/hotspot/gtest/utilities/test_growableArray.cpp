@@ -690,3 +690,31 @@ TEST(GrowableArrayCHeap, returning_references_works_as_expected) {
   EXPECT_EQ(5, first);
   EXPECT_EQ(5, last);
 }
+
+TEST_VM(GrowableArrayArena, grows_in_place_at_top) {
+  Arena arena(mtTest);
+  GrowableArray<int> a(&arena, 2, 0, 0);
+  int* data = a.adr_at(0);
+  for (int i = 0; i < 16; i++) {
+    a.append(i);
+  }
+  // Nothing else was allocated in the arena, so the data never moves.
+  EXPECT_EQ(data, a.adr_at(0));
+  for (int i = 0; i < 16; i++) {
+    EXPECT_EQ(i, a.at(i));
+  }
+}
+
+TEST_VM(GrowableArrayArena, grows_by_copy_below_top) {
+  Arena arena(mtTest);
+  GrowableArray<int> a(&arena, 2, 0, 0);
+  a.append(1);
+  a.append(2);
+  int* data = a.adr_at(0);
+  arena.Amalloc(8); // a's data is no longer the top allocation
+  a.append(3);
+  EXPECT_NE(data, a.adr_at(0));
+  EXPECT_EQ(1, a.at(0));
+  EXPECT_EQ(2, a.at(1));
+  EXPECT_EQ(3, a.at(2));
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler;
+
+/*
+ * @test TestDynamicCompilerThreadsCPUPercent
+ * @summary DynamicCompilerThreadsCPUPercent caps the compiler threads added
+ *          dynamically by the share of the active processors.
+ * @requires vm.compiler1.enabled & vm.compiler2.enabled & vm.flagless
+ * @library /test/lib
+ * @run driver compiler.TestDynamicCompilerThreadsCPUPercent
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestDynamicCompilerThreadsCPUPercent {
+    public static void main(String[] args) throws Exception {
+        // One C1 and one C2 thread are started initially. Half of the two
+        // processors does not leave room for any more.
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava("-XX:ActiveProcessorCount=2",
+                                                                    "-XX:CICompilerCount=4",
+                                                                    "-XX:+UseDynamicNumberOfCompilerThreads",
+                                                                    "-XX:+UnlockExperimentalVMOptions",
+                                                                    "-XX:DynamicCompilerThreadsCPUPercent=50",
+                                                                    "-XX:+UnlockDiagnosticVMOptions",
+                                                                    "-XX:+TraceCompilerThreads",
+                                                                    "-Xcomp",
+                                                                    "-version");
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Added initial compiler thread");
+        output.shouldNotContain("Added compiler thread");
+    }
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestG1CardTableRefinement
+ * @summary Verify the heap around young collections while concurrent refinement
+ *          sweeps the card table for the cards dirtied by old-to-young stores.
+ * @requires vm.gc.G1 & (os.arch == "amd64" | os.arch == "x86_64")
+ * @run main/othervm -Xmx64m -XX:+UseG1GC
+ *   -XX:+UnlockExperimentalVMOptions -XX:+G1UseCardTableRefinement
+ *   -XX:+UnlockDiagnosticVMOptions -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *   -Xlog:gc+refine=debug
+ *   gc.g1.TestG1CardTableRefinement
+ */
+
+import java.util.Random;
+
+public class TestG1CardTableRefinement {
+    private static final int NUM_SLOTS = 64 * 1024;
+    private static final int NUM_STORES = 4 * 1024 * 1024;
+
+    public static Object sink;
+
+    public static void main(String[] args) {
+        Object[] holder = new Object[NUM_SLOTS];
+        for (int i = 0; i < holder.length; i++) {
+            holder[i] = new Object[4];
+        }
+        // Promote the holder and its elements to the old generation.
+        System.gc();
+
+        Random random = new Random(42);
+        for (int i = 0; i < NUM_STORES; i++) {
+            Object young = new byte[random.nextInt(64)];
+            // Old-to-young stores into both the holder and its old elements.
+            holder[random.nextInt(NUM_SLOTS)] = young;
+            Object element = holder[random.nextInt(NUM_SLOTS)];
+            if (element instanceof Object[] array) {
+                array[random.nextInt(array.length)] = young;
+            }
+            sink = new byte[128];
+        }
+    }
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestG1CardTableRefinementJVMCI
+ * @summary G1UseCardTableRefinement must be turned off when JVMCI is enabled,
+ *          since JVMCI compiled code logs dirty cards in its post-barrier.
+ * @requires vm.gc.G1 & vm.jvmci & (os.arch == "amd64" | os.arch == "x86_64")
+ * @library /test/lib
+ * @run driver gc.g1.TestG1CardTableRefinementJVMCI
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestG1CardTableRefinementJVMCI {
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava("-XX:+UseG1GC",
+                                                                    "-XX:+UnlockExperimentalVMOptions",
+                                                                    "-XX:+EnableJVMCI",
+                                                                    "-XX:+G1UseCardTableRefinement",
+                                                                    "-XX:+PrintFlagsFinal",
+                                                                    "-version");
+        output.shouldContain("G1UseCardTableRefinement is not supported with -XX:+EnableJVMCI");
+        output.shouldMatch("bool G1UseCardTableRefinement\\s+= false");
+        output.shouldHaveExitValue(0);
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.serial;
+
+/*
+ * @test TestSerialAdaptiveYoungSize
+ * @summary Test that SerialAdaptiveYoungSize resizes the young generation
+ *          after young GCs.
+ * @requires vm.gc.Serial
+ * @library /test/lib
+ * @run driver gc.serial.TestSerialAdaptiveYoungSize
+ */
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestSerialAdaptiveYoungSize {
+    private static final Pattern RESIZE =
+        Pattern.compile("New generation size (\\d+)K->(\\d+)K");
+
+    public static void main(String[] args) throws Exception {
+        // MaxTenuringThreshold=0 promotes all survivors, so the survivor
+        // spaces are empty and the young generation can be resized after
+        // every young GC.
+        OutputAnalyzer out = ProcessTools.executeLimitedTestJava(
+            "-XX:+UseSerialGC",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+SerialAdaptiveYoungSize",
+            "-XX:MaxTenuringThreshold=0",
+            "-Xms256m",
+            "-Xmx256m",
+            "-XX:NewSize=8m",
+            "-XX:MaxNewSize=128m",
+            "-Xlog:gc+ergo+heap=debug",
+            Allocate.class.getName());
+        out.shouldHaveExitValue(0);
+        out.shouldContain("Adaptive young size:");
+
+        int resizes = 0;
+        Matcher m = RESIZE.matcher(out.getStdout());
+        while (m.find()) {
+            if (Long.parseLong(m.group(1)) != Long.parseLong(m.group(2))) {
+                resizes++;
+            }
+        }
+        if (resizes == 0) {
+            throw new RuntimeException("The young generation was never resized");
+        }
+    }
+
+    public static class Allocate {
+        public static Object dummy;
+
+        public static void main(String[] args) {
+            long allocated = 0;
+            while (allocated < 1024L * 1024 * 1024) {
+                dummy = new byte[16 * 1024];
+                allocated += 16 * 1024;
+            }
+        }
+    }
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.serial;
+
+/*
+ * @test TestSerialFullGCMarkBitmap
+ * @summary Reference processing and heap verification of Serial full GCs
+ *          that mark live objects in the side mark bitmap.
+ * @requires vm.gc.Serial
+ * @run main/othervm -XX:+UseSerialGC -XX:+UnlockExperimentalVMOptions
+ *   -XX:+SerialFullGCUseMarkBitmap
+ *   -XX:+UnlockDiagnosticVMOptions -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *   gc.serial.TestSerialFullGCMarkBitmap
+ */
+
+import java.lang.ref.PhantomReference;
+import java.lang.ref.Reference;
+import java.lang.ref.ReferenceQueue;
+import java.lang.ref.WeakReference;
+
+public class TestSerialFullGCMarkBitmap {
+    private static final int NUM_REFS = 1000;
+
+    public static void main(String[] args) throws Exception {
+        ReferenceQueue<Object> queue = new ReferenceQueue<>();
+        Object[] live = new Object[NUM_REFS];
+        Reference<?>[] refs = new Reference<?>[NUM_REFS * 2];
+        for (int i = 0; i < NUM_REFS; i++) {
+            // Even referents stay strongly reachable, odd ones become garbage.
+            Object referent = new int[i % 16];
+            if (i % 2 == 0) {
+                live[i] = referent;
+            }
+            refs[2 * i] = new WeakReference<>(referent, queue);
+            refs[2 * i + 1] = new PhantomReference<>(referent, queue);
+        }
+
+        for (int gc = 0; gc < 3; gc++) {
+            System.gc();
+        }
+
+        for (int i = 0; i < NUM_REFS; i++) {
+            boolean cleared = refs[2 * i].refersTo(null);
+            if (cleared == (i % 2 == 0)) {
+                throw new RuntimeException("WeakReference " + i + (cleared ? " cleared" : " not cleared"));
+            }
+            if (refs[2 * i + 1].refersTo(null) != cleared) {
+                throw new RuntimeException("PhantomReference " + i + " does not match its WeakReference");
+            }
+        }
+        Reference.reachabilityFence(live);
+        Reference.reachabilityFence(refs);
+    }
+}
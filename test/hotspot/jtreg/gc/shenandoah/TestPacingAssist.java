@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024, Red Hat, Inc. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+
+/* @test
+ * @summary Allocating threads assisting evacuation when they run out of pacing budget
+ * @key randomness
+ * @requires vm.gc.Shenandoah
+ * @library /test/lib
+ *
+ * @run main/othervm -Xmx128m -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions
+ *      -XX:+UseShenandoahGC -XX:+ShenandoahPacing -XX:+ShenandoahPacingAssist
+ *      -XX:+ShenandoahVerify
+ *      TestPacingAssist
+ * @run main/othervm -Xmx128m -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions
+ *      -XX:+UseShenandoahGC -XX:ShenandoahGCHeuristics=aggressive
+ *      -XX:+ShenandoahPacing -XX:+ShenandoahPacingAssist -XX:ShenandoahPacingMaxDelay=1
+ *      -XX:GuaranteedSafepointInterval=1
+ *      TestPacingAssist
+ */
+
+import java.util.Random;
+import jdk.test.lib.Utils;
+
+public class TestPacingAssist {
+    private static final int NUM_THREADS = 4;
+    private static final int NUM_ALLOCS = 2_000_000;
+    private static final int LIVE_SIZE = 64 * 1024;
+
+    public static void main(String[] args) throws Exception {
+        Thread[] threads = new Thread[NUM_THREADS];
+        for (int t = 0; t < NUM_THREADS; t++) {
+            long seed = Utils.getRandomInstance().nextLong();
+            threads[t] = new Thread(() -> allocate(new Random(seed)));
+            threads[t].start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+    }
+
+    private static void allocate(Random random) {
+        // Keep a live set around, so that there is something to evacuate.
+        Object[] live = new Object[LIVE_SIZE];
+        for (int i = 0; i < NUM_ALLOCS; i++) {
+            byte[] obj = new byte[random.nextInt(256)];
+            int idx = random.nextInt(LIVE_SIZE);
+            if (live[idx] instanceof byte[] old && old.length != 0 && old[0] != (byte)old.length) {
+                throw new IllegalStateException("Object contents corrupted");
+            }
+            if (obj.length != 0) {
+                obj[0] = (byte)obj.length;
+            }
+            live[idx] = obj;
+        }
+    }
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.Random;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Reductions over long and double arrays: simple ones, chains of several
+ * reductions in the same loop, and reductions guarded by a condition.
+ * Comparing the runs with -XX:-UseSuperWord shows which of them are
+ * vectorized.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3)
+public class VectorReductionChains {
+
+    @Param({"2048"})
+    public int size;
+
+    private long[] longs;
+    private double[] doubles;
+
+    @Setup
+    public void setup() {
+        Random random = new Random(42);
+        longs = new long[size];
+        doubles = new double[size];
+        for (int i = 0; i < size; i++) {
+            longs[i] = random.nextLong();
+            doubles[i] = random.nextDouble();
+        }
+    }
+
+    @Benchmark
+    public long longAdd() {
+        long sum = 0;
+        for (int i = 0; i < longs.length; i++) {
+            sum += longs[i];
+        }
+        return sum;
+    }
+
+    @Benchmark
+    public long longMax() {
+        long max = Long.MIN_VALUE;
+        for (int i = 0; i < longs.length; i++) {
+            max = Math.max(max, longs[i]);
+        }
+        return max;
+    }
+
+    @Benchmark
+    public long longMinMaxAddChain() {
+        long min = Long.MAX_VALUE;
+        long max = Long.MIN_VALUE;
+        long sum = 0;
+        for (int i = 0; i < longs.length; i++) {
+            long v = longs[i];
+            min = Math.min(min, v);
+            max = Math.max(max, v);
+            sum += v;
+        }
+        return min + max + sum;
+    }
+
+    @Benchmark
+    public long longConditionalAdd() {
+        long sum = 0;
+        for (int i = 0; i < longs.length; i++) {
+            long v = longs[i];
+            if (v > 0) {
+                sum += v;
+            }
+        }
+        return sum;
+    }
+
+    @Benchmark
+    public double doubleMax() {
+        double max = Double.NEGATIVE_INFINITY;
+        for (int i = 0; i < doubles.length; i++) {
+            max = Math.max(max, doubles[i]);
+        }
+        return max;
+    }
+
+    @Benchmark
+    public double doubleMinMaxChain() {
+        double min = Double.POSITIVE_INFINITY;
+        double max = Double.NEGATIVE_INFINITY;
+        for (int i = 0; i < doubles.length; i++) {
+            double v = doubles[i];
+            min = Math.min(min, v);
+            max = Math.max(max, v);
+        }
+        return min + max;
+    }
+
+    @Benchmark
+    public double doubleConditionalMax() {
+        double max = Double.NEGATIVE_INFINITY;
+        for (int i = 0; i < doubles.length; i++) {
+            double v = doubles[i];
+            if (v < 0.5) {
+                max = Math.max(max, v);
+            }
+        }
+        return max;
+    }
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Allocation throughput of small objects and arrays for each collector,
+ * at a few fixed TLAB sizes. The nested classes select the collector;
+ * add -prof gc or -prof jfr to see the GC work behind each result. The
+ * Shenandoah variant fails to start on builds without Shenandoah.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3)
+public abstract class Allocation {
+
+    @Param({"16", "256", "4096"})
+    public int arrayLength;
+
+    @Benchmark
+    public Object object() {
+        return new Object();
+    }
+
+    @Benchmark
+    public Object byteArray() {
+        return new byte[arrayLength];
+    }
+
+    @Benchmark
+    public Object objectArray() {
+        return new Object[arrayLength];
+    }
+
+    @Fork(jvmArgsAppend = {"-XX:+UseSerialGC"})
+    public static class Serial extends Allocation {}
+
+    @Fork(jvmArgsAppend = {"-XX:+UseParallelGC"})
+    public static class Parallel extends Allocation {}
+
+    @Fork(jvmArgsAppend = {"-XX:+UseG1GC"})
+    public static class G1 extends Allocation {}
+
+    @Fork(jvmArgsAppend = {"-XX:+UseZGC"})
+    public static class Z extends Allocation {}
+
+    @Fork(jvmArgsAppend = {"-XX:+UseShenandoahGC"})
+    public static class Shenandoah extends Allocation {}
+
+    @Fork(jvmArgsAppend = {"-XX:+UseG1GC", "-XX:-ResizeTLAB", "-XX:TLABSize=64k"})
+    public static class G1SmallTLAB extends Allocation {}
+
+    @Fork(jvmArgsAppend = {"-XX:+UseG1GC", "-XX:-ResizeTLAB", "-XX:TLABSize=4m"})
+    public static class G1LargeTLAB extends Allocation {}
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Reference store cost for each collector's write barrier: null stores,
+ * stores of young objects into an old array, and stores between old
+ * objects. The nested classes run the same benchmarks with a specific
+ * collector; add -prof jfr to break results down by GC phase. The
+ * Shenandoah variant fails to start on builds without Shenandoah.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3)
+public abstract class WriteBarrier {
+
+    private static final int SIZE = 1024;
+
+    private Object[] oldArray;
+    private Object[] oldTargets;
+
+    @Setup
+    public void setup() {
+        oldArray = new Object[SIZE];
+        oldTargets = new Object[SIZE];
+        for (int i = 0; i < SIZE; i++) {
+            oldTargets[i] = new Object();
+        }
+        // Promote the arrays and their targets before measuring.
+        System.gc();
+    }
+
+    /**
+     * A pool of young targets, allocated right before each iteration so
+     * they are still young while it runs. storeYoungToOld cycles through
+     * the pool, so it measures the stores rather than the allocation of
+     * their targets. Kept out of the main state so the other benchmarks
+     * do not pay for it.
+     */
+    @State(Scope.Thread)
+    public static class YoungTargets {
+        private static final int POOL_SIZE = 256;
+
+        private Object[][] pool;
+        private int next;
+
+        @Setup(Level.Iteration)
+        public void setup() {
+            pool = new Object[POOL_SIZE][];
+            for (int p = 0; p < POOL_SIZE; p++) {
+                Object[] targets = new Object[SIZE];
+                for (int i = 0; i < targets.length; i++) {
+                    targets[i] = new Object();
+                }
+                pool[p] = targets;
+            }
+            next = 0;
+        }
+
+        public Object[] nextTargets() {
+            Object[] targets = pool[next];
+            next = (next + 1) % POOL_SIZE;
+            return targets;
+        }
+    }
+
+    @Benchmark
+    public void storeNull() {
+        Object[] a = oldArray;
+        for (int i = 0; i < a.length; i++) {
+            a[i] = null;
+        }
+    }
+
+    @Benchmark
+    public void storeOldToOld() {
+        Object[] a = oldArray;
+        Object[] t = oldTargets;
+        for (int i = 0; i < a.length; i++) {
+            a[i] = t[i];
+        }
+    }
+
+    @Benchmark
+    public void storeYoungToOld(YoungTargets young) {
+        Object[] a = oldArray;
+        Object[] t = young.nextTargets();
+        for (int i = 0; i < a.length; i++) {
+            a[i] = t[i];
+        }
+    }
+
+    @Fork(jvmArgsAppend = {"-XX:+UseSerialGC"})
+    public static class Serial extends WriteBarrier {}
+
+    @Fork(jvmArgsAppend = {"-XX:+UseParallelGC"})
+    public static class Parallel extends WriteBarrier {}
+
+    @Fork(jvmArgsAppend = {"-XX:+UseG1GC"})
+    public static class G1 extends WriteBarrier {}
+
+    @Fork(jvmArgsAppend = {"-XX:+UseZGC"})
+    public static class Z extends WriteBarrier {}
+
+    @Fork(jvmArgsAppend = {"-XX:+UseShenandoahGC"})
+    public static class Shenandoah extends WriteBarrier {}
+}